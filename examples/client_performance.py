@@ -1,83 +1,340 @@
 #!/usr/bin/env python3
-"""Test performance of client: sync vs. async.
+"""Benchmark request/response throughput and latency.
 
-This example show how much faster the async version is.
+Runs the async and sync clients against an in-process server, for
+every transport (tcp, udp, tls, nullmodem) and framer, and reports
+per case:
 
-example run:
+- throughput (requests/s)
+- p50/p99 latency (ms)
+- allocated bytes per request (tracemalloc peak above the memory in use
+  before the request, averaged over a separate, shorter, pass of single
+  requests to avoid skewing the timing), for socket transports this
+  includes the 256k receive buffer allocated by asyncio for each read
 
-(pymodbus) % ./client_performance.py
---- Testing sync client v3.4.1
-running 1000 call (each 10 registers), took 114.10 seconds
-Averages 114.10 ms pr call and 11.41 ms pr register.
---- Testing async client v3.4.1
-running 1000 call (each 10 registers), took 0.33 seconds
-Averages 0.33 ms pr call and 0.03 ms pr register.
+usage::
+
+    client_performance.py [-h] [--count COUNT] [--registers REGISTERS]
+                          [--comm {tcp,udp,tls,nullmodem} ...]
+                          [--framer {socket,rtu,ascii,tls} ...]
+                          [--client {async,sync} ...] [--json FILE]
+                          [--decode] [--request-pool SIZE]
+
+    --json FILE
+        also write the results as json, to track regressions between releases.
+    --decode
+        only run the decode microbenchmark, reporting the cost (us) of
+        decoding one pdu with the server and client decoders, and with
+        the server decoder through a request pool (decode + release).
+    --request-pool SIZE
+        set server.request_pool_size, to reuse request objects.
+
+example run::
+
+    (pymodbus) % ./client_performance.py --comm tcp --framer socket
+    client comm      framer  req/s    p50 ms  p99 ms  bytes/req
+    async  tcp       socket  6962     0.139   0.201   8910
+    sync   tcp       socket  6918     0.136   0.213   8994
+
+The sync client is not run with:
+
+- nullmodem, which is only available within a single asyncio loop.
+- tls, the sync client cannot determine the end of a tls frame and
+  waits for the timeout on each response.
 """
+from __future__ import annotations
+
+import argparse
 import asyncio
+import json
+import os
+import platform
 import time
+import tracemalloc
 
-from pymodbus import FramerType
-from pymodbus.client import AsyncModbusSerialClient, ModbusSerialClient
+import pymodbus.client as modbusClient
+from pymodbus import FramerType, __version__
+from pymodbus.datastore import (
+    ModbusSequentialDataBlock,
+    ModbusServerContext,
+    ModbusSlaveContext,
+)
+from pymodbus.factory import ClientDecoder, ModbusRequestPool, ServerDecoder
+from pymodbus.server import ModbusTcpServer, ModbusTlsServer, ModbusUdpServer
+from pymodbus.transport import NULLMODEM_HOST
 
 
-LOOP_COUNT = 1000
-REGISTER_COUNT = 10
+COMM_FRAMERS = {
+    "tcp": ("socket", "rtu", "ascii"),
+    "udp": ("socket", "rtu", "ascii"),
+    "tls": ("tls",),
+    "nullmodem": ("socket", "rtu", "ascii"),
+}
+CERTIFICATE = os.path.join(os.path.dirname(__file__), "certificates", "pymodbus")
+HOST = "127.0.0.1"
+DECODE_PDUS = {
+    "server": {
+        "read_holding": b"\x03\x00\x00\x00\x0a",
+        "write_registers": b"\x10\x00\x00\x00\x02\x04\x00\x01\x00\x02",
+        "diag_echo": b"\x08\x00\x00\x12\x34",
+        "device_info": b"\x2b\x0e\x01\x00",
+        "illegal": b"\x60\x00",
+    },
+    "client": {
+        "read_holding": b"\x03\x14" + b"\x00\x11" * 10,
+        "write_registers": b"\x10\x00\x00\x00\x02",
+        "diag_echo": b"\x08\x00\x00\x12\x34",
+        "exception": b"\x83\x02",
+    },
+}
 
 
-def run_sync_client_test():
-    """Run sync client."""
-    print("--- Testing sync client v3.4.1")
-    client = ModbusSerialClient(
-        "/dev/ttys007",
-        framer_name=FramerType.RTU,
-        baudrate=9600,
+def get_commandline(cmdline=None):
+    """Read and validate command line arguments."""
+    parser = argparse.ArgumentParser(description="pymodbus request/response benchmark")
+    parser.add_argument("--count", help="requests per case", default=1000, type=int)
+    parser.add_argument("--registers", help="registers per request", default=10, type=int)
+    parser.add_argument(
+        "--comm",
+        choices=list(COMM_FRAMERS),
+        nargs="+",
+        default=list(COMM_FRAMERS),
+        help="set communication(s), default is all",
     )
-    client.connect()
-    assert client.connected
-
-    start_time = time.time()
-    for _i in range(LOOP_COUNT):
-        rr = client.read_input_registers(1, REGISTER_COUNT, slave=1)
-        if rr.isError():
-            print(f"Received Modbus library error({rr})")
-            break
-    client.close()
-    run_time = time.time() - start_time
-    avg_call = (run_time / LOOP_COUNT) * 1000
-    avg_register = avg_call / REGISTER_COUNT
-    print(
-        f"running {LOOP_COUNT} call (each {REGISTER_COUNT} registers), took {run_time:.2f} seconds"
+    parser.add_argument(
+        "--framer",
+        choices=["socket", "rtu", "ascii", "tls"],
+        nargs="+",
+        help="set framer(s), default is all valid for each --comm",
     )
-    print(f"Averages {avg_call:.2f} ms pr call and {avg_register:.2f} ms pr register.")
+    parser.add_argument(
+        "--client",
+        choices=["async", "sync"],
+        nargs="+",
+        default=["async", "sync"],
+        help="set client type(s), default is both",
+    )
+    parser.add_argument("--json", help="write results as json to file", type=str)
+    parser.add_argument("--decode", help="only run decode microbenchmark", action="store_true")
+    parser.add_argument("--request-pool", help="server request pool size", default=0, type=int)
+    return parser.parse_args(cmdline)
+
+
+def get_cases(args):
+    """Return list of (client, comm, framer) to run."""
+    cases = []
+    for client in args.client:
+        for comm in args.comm:
+            if client == "sync" and comm in ("nullmodem", "tls"):
+                continue
+            for framer in COMM_FRAMERS[comm]:
+                if not args.framer or framer in args.framer:
+                    cases.append((client, comm, framer))
+    return cases
 
 
-async def run_async_client_test():
-    """Run async client."""
-    print("--- Testing async client v3.4.1")
-    client = AsyncModbusSerialClient(
-        "/dev/ttys007",
-        framer_name=FramerType.RTU,
-        baudrate=9600,
+async def start_server(comm, framer, request_pool):
+    """Start server, return (server, port)."""
+    context = ModbusServerContext(
+        slaves=ModbusSlaveContext(ir=ModbusSequentialDataBlock(0, [17] * 200)),
+        single=True,
     )
-    await client.connect()
-    assert client.connected
+    if comm == "nullmodem":
+        server = ModbusTcpServer(context, framer=framer, address=(NULLMODEM_HOST, 5020))
+        server.comm_params.host = NULLMODEM_HOST
+    elif comm == "tls":
+        server = ModbusTlsServer(
+            context,
+            framer=framer,
+            address=(HOST, 0),
+            certfile=f"{CERTIFICATE}.crt",
+            keyfile=f"{CERTIFICATE}.key",
+        )
+    elif comm == "udp":
+        server = ModbusUdpServer(context, framer=framer, address=(HOST, 0))
+    else:
+        server = ModbusTcpServer(context, framer=framer, address=(HOST, 0))
+    server.request_pool_size = request_pool
+    if not await server.listen():
+        raise RuntimeError(f"server {comm}/{framer} failed to start")
+    if comm == "nullmodem":
+        return server, 5020
+    if comm == "udp":
+        return server, server.transport.get_extra_info("sockname")[1]
+    return server, server.transport.sockets[0].getsockname()[1]
+
+
+def create_client(client_type, comm, framer, port):
+    """Create client object."""
+    kwargs = {"port": port, "framer": FramerType(framer), "timeout": 5, "retries": 0}
+    if comm == "tls":
+        cls = modbusClient.AsyncModbusTlsClient if client_type == "async" else modbusClient.ModbusTlsClient
+        kwargs["sslctx"] = cls.generate_ssl(
+            certfile=f"{CERTIFICATE}.crt", keyfile=f"{CERTIFICATE}.key"
+        )
+        kwargs["server_hostname"] = "localhost"
+    elif comm == "udp":
+        cls = modbusClient.AsyncModbusUdpClient if client_type == "async" else modbusClient.ModbusUdpClient
+    else:
+        cls = modbusClient.AsyncModbusTcpClient if client_type == "async" else modbusClient.ModbusTcpClient
+    host = NULLMODEM_HOST if comm == "nullmodem" else HOST
+    return cls(host, **kwargs)
 
-    start_time = time.time()
-    for _i in range(LOOP_COUNT):
-        rr = await client.read_input_registers(1, REGISTER_COUNT, slave=1)
+
+async def run_async_client(client, count, registers, latencies):
+    """Run requests with async client."""
+    for _ in range(count):
+        start = time.perf_counter()
+        rr = await client.read_input_registers(0, registers, slave=1)
+        latencies.append(time.perf_counter() - start)
         if rr.isError():
-            print(f"Received Modbus library error({rr})")
-            break
-    client.close()
-    run_time = time.time() - start_time
-    avg_call = (run_time / LOOP_COUNT) * 1000
-    avg_register = avg_call / REGISTER_COUNT
-    print(
-        f"running {LOOP_COUNT} call (each {REGISTER_COUNT} registers), took {run_time:.2f} seconds"
-    )
-    print(f"Averages {avg_call:.2f} ms pr call and {avg_register:.2f} ms pr register.")
+            raise RuntimeError(f"Received Modbus library error({rr})")
+
+
+def run_sync_client(client, count, registers, latencies):
+    """Run requests with sync client."""
+    for _ in range(count):
+        start = time.perf_counter()
+        rr = client.read_input_registers(0, registers, slave=1)
+        latencies.append(time.perf_counter() - start)
+        if rr.isError():
+            raise RuntimeError(f"Received Modbus library error({rr})")
+
+
+async def run_requests(client_type, client, count, registers):
+    """Run count requests, return latencies."""
+    latencies: list[float] = []
+    if client_type == "async":
+        await run_async_client(client, count, registers, latencies)
+    else:
+        await asyncio.to_thread(run_sync_client, client, count, registers, latencies)
+    return latencies
+
+
+async def run_case(client_type, comm, framer, count, registers, request_pool=0):
+    """Run one benchmark case, return result dict."""
+    result = {"client": client_type, "comm": comm, "framer": framer, "count": count, "registers": registers}
+    server, port = await start_server(comm, framer, request_pool)
+    client = create_client(client_type, comm, framer, port)
+    try:
+        if client_type == "async":
+            connected = await client.connect()
+        else:
+            connected = await asyncio.to_thread(client.connect)
+        if not connected:
+            raise RuntimeError("client failed to connect")
+        await run_requests(client_type, client, min(count // 10, 100), registers)  # warm up
+
+        start = time.perf_counter()
+        latencies = sorted(await run_requests(client_type, client, count, registers))
+        run_time = time.perf_counter() - start
+
+        alloc_count = max(min(count // 10, 200), 1)
+        alloc_bytes = 0
+        tracemalloc.start()
+        for _ in range(alloc_count):
+            base, _ = tracemalloc.get_traced_memory()
+            tracemalloc.reset_peak()
+            await run_requests(client_type, client, 1, registers)
+            _, peak = tracemalloc.get_traced_memory()
+            alloc_bytes += peak - base
+        tracemalloc.stop()
+
+        result.update(
+            {
+                "req_per_sec": round(count / run_time, 1),
+                "p50_ms": round(latencies[len(latencies) // 2] * 1000, 3),
+                "p99_ms": round(latencies[min(int(len(latencies) * 0.99), len(latencies) - 1)] * 1000, 3),
+                "bytes_per_req": alloc_bytes // alloc_count,
+            }
+        )
+    except Exception as exc:  # pylint: disable=broad-exception-caught
+        result["error"] = str(exc) or exc.__class__.__name__
+    finally:
+        client.close()
+        await server.shutdown()
+        await asyncio.sleep(0.1)
+    return result
+
+
+def run_decode(count):
+    """Run decode microbenchmark, return result list."""
+    pool = ModbusRequestPool(ServerDecoder())
+
+    def pool_decode(data):
+        request = pool.decode(data)
+        pool.release(request)
+        return request
+
+    decoders = {
+        "server": (ServerDecoder().decode, DECODE_PDUS["server"]),
+        "pool": (pool_decode, DECODE_PDUS["server"]),
+        "client": (ClientDecoder().decode, DECODE_PDUS["client"]),
+    }
+    results = []
+    for side, (decode, pdus) in decoders.items():
+        for name, data in pdus.items():
+            start = time.perf_counter()
+            for _ in range(count):
+                decode(data)
+            run_time = time.perf_counter() - start
+            results.append(
+                {
+                    "decoder": side,
+                    "pdu": name,
+                    "class": decode(data).__class__.__name__,
+                    "count": count,
+                    "us_per_pdu": round(run_time / count * 1e6, 3),
+                }
+            )
+    return results
+
+
+def print_decode_results(results):
+    """Print decode results as table."""
+    print(f"{'decoder':7} {'pdu':15} {'class':38} us/pdu")
+    for res in results:
+        print(f"{res['decoder']:7} {res['pdu']:15} {res['class']:38} {res['us_per_pdu']:.3f}")
+
+
+def print_results(results):
+    """Print results as table."""
+    print(f"{'client':6} {'comm':9} {'framer':7} {'req/s':8} {'p50 ms':7} {'p99 ms':7} bytes/req")
+    for res in results:
+        line = f"{res['client']:6} {res['comm']:9} {res['framer']:7} "
+        if "error" in res:
+            print(f"{line}ERROR {res['error']}")
+            continue
+        print(f"{line}{res['req_per_sec']:<8.0f} {res['p50_ms']:<7.3f} {res['p99_ms']:<7.3f} {res['bytes_per_req']}")
+
+
+async def main(cmdline=None):
+    """Run benchmark."""
+    args = get_commandline(cmdline)
+    if args.decode:
+        results = run_decode(args.count * 10)
+        print_decode_results(results)
+    else:
+        results = [
+            await run_case(client_type, comm, framer, args.count, args.registers, args.request_pool)
+            for client_type, comm, framer in get_cases(args)
+        ]
+        print_results(results)
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as json_file:
+            json.dump(
+                {
+                    "pymodbus": __version__,
+                    "python": platform.python_version(),
+                    "platform": platform.platform(),
+                    "time": time.strftime("%Y-%m-%dT%H:%M:%S"),
+                    "results": results,
+                },
+                json_file,
+                indent=2,
+            )
+    return results
 
 
 if __name__ == "__main__":
-    run_sync_client_test()
-    asyncio.run(run_async_client_test())
+    asyncio.run(main())
@@ -1,5 +1,5 @@
 #!/usr/bin/env python3
-"""Pymodbus synchronous forwarder.
+"""Pymodbus asynchronous forwarder.
 
 This is a repeater or converter and an example of just how powerful datastore is.
 
@@ -12,9 +12,11 @@ a) server receives a read/write request from external client:
     - server sends new response to external client
 
 Both server and client are tcp based, but it can be easily modified to any server/client
-(see client_sync.py and server_sync.py for other communication types)
+(see client_async.py and server_async.py for other communication types)
 
-**WARNING** This example is a simple solution, that do only forward read requests.
+AsyncRemoteSlaveContext coalesces concurrent reads from many external clients
+into shared requests to the target server, and the client pipelines them
+(max_inflight).
 """
 import asyncio
 import logging
@@ -29,9 +31,9 @@ except ImportError:
           for more information.")
     sys.exit(-1)
 
-from pymodbus.client import ModbusTcpClient
+from pymodbus.client import AsyncModbusTcpClient
 from pymodbus.datastore import ModbusServerContext
-from pymodbus.datastore.remote import RemoteSlaveContext
+from pymodbus.datastore.remote import AsyncRemoteSlaveContext
 from pymodbus.server import StartAsyncTcpServer
 
 
@@ -48,22 +50,23 @@ async def run_forwarder(args):
     txt = f"### start forwarder, listen {args.port}, connect to {args.client_port}"
     _logger.info(txt)
 
-    args.client = ModbusTcpClient(
+    args.client = AsyncModbusTcpClient(
         host="localhost",
         port=args.client_port,
+        max_inflight=8,
     )
-    args.client.connect()
+    await args.client.connect()
     assert args.client.connected
     # If required to communicate with a specified client use slave=<slave_id>
-    # in RemoteSlaveContext
+    # in AsyncRemoteSlaveContext
     # For e.g to forward the requests to slave with slave address 1 use
-    # store = RemoteSlaveContext(client, slave=1)
+    # store = AsyncRemoteSlaveContext(client, slave=1)
     if args.slaves:
         store = {}
         for i in args.slaves:
-            store[i.to_bytes(1, "big")] = RemoteSlaveContext(args.client, slave=i)
+            store[i.to_bytes(1, "big")] = AsyncRemoteSlaveContext(args.client, slave=i)
     else:
-        store = RemoteSlaveContext(args.client, slave=1)
+        store = AsyncRemoteSlaveContext(args.client, slave=1)
     args.context = ModbusServerContext(slaves=store, single=True)
 
     await StartAsyncTcpServer(context=args.context, address=("", args.port))
@@ -8,13 +8,17 @@ __all__ = [
     "FramerType",
     "ModbusException",
     "pymodbus_apply_logging_config",
+    "pymodbus_hot_path_logging",
     "__version__",
     "__version_full__",
 ]
 
 from pymodbus.exceptions import ModbusException
 from pymodbus.framer import FramerType
-from pymodbus.logging import pymodbus_apply_logging_config
+from pymodbus.logging import (
+    pymodbus_apply_logging_config,
+    pymodbus_hot_path_logging,
+)
 from pymodbus.pdu import ExceptionResponse
 
 
@@ -3,6 +3,7 @@ from __future__ import annotations
 
 import asyncio
 import socket
+import time
 from collections.abc import Awaitable, Callable
 from dataclasses import dataclass
 from typing import Any, cast
@@ -11,8 +12,14 @@ from pymodbus.client.mixin import ModbusClientMixin
 from pymodbus.client.modbusclientprotocol import ModbusClientProtocol
 from pymodbus.exceptions import ConnectionException, ModbusIOException
 from pymodbus.factory import ClientDecoder
-from pymodbus.framer import FRAMER_NAME_TO_CLASS, FramerType, ModbusFramer
+from pymodbus.framer import (
+    FRAMER_NAME_TO_CLASS,
+    FramerType,
+    ModbusFramer,
+    ModbusSocketFramer,
+)
 from pymodbus.logging import Log
+from pymodbus.metrics import ModbusConnectionStats, ModbusMetrics
 from pymodbus.pdu import ModbusRequest, ModbusResponse
 from pymodbus.transaction import ModbusTransactionManager
 from pymodbus.transport import CommParams
@@ -36,6 +43,8 @@ class ModbusBaseClient(ModbusClientMixin[Awaitable[ModbusResponse]]):
     :param reconnect_delay_max: Maximum delay in seconds.milliseconds before reconnecting.
     :param on_connect_callback: Will be called when connected/disconnected (bool parameter)
     :param no_resend_on_retry: Do not resend request when retrying due to missing response.
+    :param max_inflight: Max number of requests sent without waiting for the response.
+    :param metrics: Collect request metrics in this (shareable) ModbusMetrics object.
     :param kwargs: Experimental parameters.
 
     .. tip::
@@ -43,6 +52,14 @@ class ModbusBaseClient(ModbusClientMixin[Awaitable[ModbusResponse]]):
         **reconnect_delay** to **reconnect_delay_max**.
         Set `reconnect_delay=0` to avoid automatic reconnection.
 
+    .. tip::
+        **max_inflight** > 1 allows concurrent calls (e.g. :mod:`asyncio.gather`) to share
+        the connection, responses are matched using the transaction id.
+        This requires `framer=FramerType.SOCKET`, all other framers use 1.
+        A request without response (after retries) only fails itself, unless no
+        response at all was received meanwhile, then the connection is closed and
+        reconnected, failing all pending requests.
+
     :mod:`ModbusBaseClient` is normally not referenced outside :mod:`pymodbus`.
 
     **Application methods, common to all clients**:
@@ -59,6 +76,8 @@ class ModbusBaseClient(ModbusClientMixin[Awaitable[ModbusResponse]]):
         reconnect_delay_max: float = 300,
         on_connect_callback: Callable[[bool], None] | None = None,
         no_resend_on_retry: bool = False,
+        max_inflight: int = 1,
+        metrics: ModbusMetrics | None = None,
         **kwargs: Any,
     ) -> None:
         """Initialize a client instance."""
@@ -94,7 +113,19 @@ class ModbusBaseClient(ModbusClientMixin[Awaitable[ModbusResponse]]):
         self.state = ModbusTransactionState.IDLE
         self.last_frame_end: float | None = 0
         self.silent_interval: float = 0
-        self._lock = asyncio.Lock()
+        if max_inflight > 1 and not isinstance(self.ctx.framer, ModbusSocketFramer):
+            Log.warning(
+                "max_inflight={} requires a framer with transaction id, using 1",
+                max_inflight,
+            )
+            max_inflight = 1
+        self.max_inflight = max(1, max_inflight)
+        self._lock = asyncio.Semaphore(self.max_inflight)
+        self.stats: ModbusConnectionStats | None = None
+        if metrics is not None:
+            params = self.ctx.comm_params
+            name = f"{params.host}:{params.port}" if params.port else str(params.host)
+            self.stats = self.ctx.stats = metrics.connection(name)
 
     # ----------------------------------------------------------------------- #
     # Client external interface
@@ -161,15 +192,41 @@ class ModbusBaseClient(ModbusClientMixin[Awaitable[ModbusResponse]]):
         """Execute requests asynchronously."""
         request.transaction_id = self.ctx.transaction.getNextTID()
         packet = self.ctx.framer.buildPacket(request)
-
+        if not (conn := self.stats):
+            return await self._execute(request, packet, None)
+        stats = conn.request(request.slave_id, request.function_code)
+        conn.enqueue()
+        start = time.perf_counter()
+        try:
+            resp = await self._execute(request, packet, stats)
+        except ModbusIOException:
+            stats.errors += 1
+            raise
+        finally:
+            conn.dequeue()
+        stats.done(start, resp)
+        return resp
+
+    async def _execute(self, request, packet, stats) -> ModbusResponse:
+        """Send request and wait for response, with retries."""
         count = 0
+        responses = self.ctx.responses
         while count <= self.retries:
             async with self._lock:
                 req = self.build_response(request.transaction_id)
                 if not count or not self.no_resend_on_retry:
-                    self.ctx.framer.resetFrame()
+                    if len(self.ctx.transaction.transactions) <= 1:
+                        # only reset when no other responses are pending
+                        self.ctx.framer.resetFrame()
+                    if self.ctx.bus_timing:
+                        await self.ctx.bus_timing.wait()
                     self.ctx.send(packet)
+                    if self.ctx.bus_timing:
+                        self.ctx.bus_timing.sent(len(packet))
+                    if stats:
+                        self.stats.bytes_out += len(packet)  # type: ignore[union-attr]
                 if self.broadcast_enable and not request.slave_id:
+                    self.ctx.transaction.delTransaction(request.transaction_id)
                     resp = None
                     break
                 try:
@@ -178,15 +235,40 @@ class ModbusBaseClient(ModbusClientMixin[Awaitable[ModbusResponse]]):
                     )
                     break
                 except asyncio.exceptions.TimeoutError:
+                    self.ctx.transaction.delTransaction(request.transaction_id)
                     count += 1
+                    if stats:
+                        stats.timeouts += 1
+                        stats.retries += count <= self.retries
         if count > self.retries:
-            self.close(reconnect=True)
+            if self.ctx.responses == responses:
+                # the connection is dead, other responses would have arrived otherwise.
+                self.close(reconnect=True)
             raise ModbusIOException(
                 f"ERROR: No response received after {self.retries} retries"
             )
 
         return resp  # type: ignore[return-value]
 
+    async def read_tags(
+        self, tags: list[tuple[int, int, int]], function_code: int = 3, max_gap: int = 0
+    ) -> list[list[int] | list[bool] | ModbusResponse]:
+        """Read scattered tags with the fewest requests (call **async**).
+
+        :param tags: list of (slave, address, count)
+        :param function_code: 1 (coils), 2 (discrete inputs), 3 (holding) or 4 (input registers)
+        :param max_gap: max number of unwanted registers/bits read to join 2 tags
+        :returns: registers/bits per tag (error response if the request failed)
+        :raises ModbusException: Check exception text.
+
+        The requests are sent concurrently, allowing **max_inflight** to pipeline them.
+        """
+        blocks = self.plan_reads(tags, function_code, max_gap)
+        responses = await asyncio.gather(
+            *(self.execute(block.request) for block in blocks)
+        )
+        return self.scatter_reads(tags, blocks, responses)
+
     def build_response(self, tid):
         """Return a deferred response for the current request."""
         my_future: asyncio.Future = asyncio.Future()
@@ -248,6 +330,7 @@ class ModbusBaseSyncClient(ModbusClientMixin[ModbusResponse]):
     :param reconnect_delay: Minimum delay in seconds.milliseconds before reconnecting.
     :param reconnect_delay_max: Maximum delay in seconds.milliseconds before reconnecting.
     :param no_resend_on_retry: Do not resend request when retrying due to missing response.
+    :param metrics: Collect request metrics in this (shareable) ModbusMetrics object.
     :param kwargs: Experimental parameters.
 
     .. tip::
@@ -280,6 +363,7 @@ class ModbusBaseSyncClient(ModbusClientMixin[ModbusResponse]):
         reconnect_delay: float = 0.1,
         reconnect_delay_max: float = 300.0,
         no_resend_on_retry: bool = False,
+        metrics: ModbusMetrics | None = None,
         **kwargs: Any,
     ) -> None:
         """Initialize a client instance."""
@@ -321,6 +405,11 @@ class ModbusBaseSyncClient(ModbusClientMixin[ModbusResponse]):
         self.last_frame_end: float | None = 0
         self.silent_interval: float = 0
         self.transport = None
+        self.stats: ModbusConnectionStats | None = None
+        if metrics is not None:
+            params = self.comm_params
+            name = f"{params.host}:{params.port}" if params.port else str(params.host)
+            self.stats = metrics.connection(name)
 
     # ----------------------------------------------------------------------- #
     # Client external interface
@@ -355,7 +444,28 @@ class ModbusBaseSyncClient(ModbusClientMixin[ModbusResponse]):
         """
         if not self.connect():
             raise ConnectionException(f"Failed to connect[{self!s}]")
-        return self.transaction.execute(request)
+        if not self.stats:
+            return self.transaction.execute(request)
+        stats = self.stats.request(request.slave_id, request.function_code)
+        start = time.perf_counter()
+        response = self.transaction.execute(request)
+        stats.done(start, response)
+        return response
+
+    def read_tags(
+        self, tags: list[tuple[int, int, int]], function_code: int = 3, max_gap: int = 0
+    ) -> list[list[int] | list[bool] | ModbusResponse]:
+        """Read scattered tags with the fewest requests (call **sync**).
+
+        :param tags: list of (slave, address, count)
+        :param function_code: 1 (coils), 2 (discrete inputs), 3 (holding) or 4 (input registers)
+        :param max_gap: max number of unwanted registers/bits read to join 2 tags
+        :returns: registers/bits per tag (error response if the request failed)
+        :raises ModbusException: Check exception text.
+        """
+        blocks = self.plan_reads(tags, function_code, max_gap)
+        responses = [self.execute(block.request) for block in blocks]
+        return self.scatter_reads(tags, blocks, responses)
 
     # ----------------------------------------------------------------------- #
     # Internal methods
@@ -366,7 +476,8 @@ class ModbusBaseSyncClient(ModbusClientMixin[ModbusResponse]):
         :meta private:
         """
         if self.state != ModbusTransactionState.RETRYING:
-            Log.debug('New Transaction state "SENDING"')
+            if Log.hot_path:
+                Log.debug('New Transaction state "SENDING"')
             self.state = ModbusTransactionState.SENDING
         return request
 
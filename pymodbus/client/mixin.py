@@ -2,6 +2,7 @@
 from __future__ import annotations
 
 import struct
+from dataclasses import dataclass, field
 from enum import Enum
 from typing import Any, Generic, TypeVar
 
@@ -14,7 +15,7 @@ import pymodbus.pdu.other_message as pdu_other_msg
 import pymodbus.pdu.register_read_message as pdu_reg_read
 import pymodbus.pdu.register_write_message as pdu_req_write
 from pymodbus.exceptions import ModbusException
-from pymodbus.pdu import ModbusRequest
+from pymodbus.pdu import ModbusRequest, ModbusResponse
 
 
 T = TypeVar("T", covariant=False)
@@ -558,3 +559,101 @@ class ModbusClientMixin(Generic[T]):  # pylint: disable=too-many-public-methods
             for x in range(0, len(byte_list), 2)
         ]
         return regs
+
+    # ------------------
+    # Read planner methods
+    # ------------------
+
+    READ_PLAN_LIMITS: dict[int, tuple[type[ModbusRequest], int]] = {
+        pdu_bit_read.ReadCoilsRequest.function_code: (
+            pdu_bit_read.ReadCoilsRequest, 2000
+        ),
+        pdu_bit_read.ReadDiscreteInputsRequest.function_code: (
+            pdu_bit_read.ReadDiscreteInputsRequest, 2000
+        ),
+        pdu_reg_read.ReadHoldingRegistersRequest.function_code: (
+            pdu_reg_read.ReadHoldingRegistersRequest, 125
+        ),
+        pdu_reg_read.ReadInputRegistersRequest.function_code: (
+            pdu_reg_read.ReadInputRegistersRequest, 125
+        ),
+    }
+
+    @dataclass
+    class ReadBlock:
+        """Coalesced read request, used for plan_reads/scatter_reads calls."""
+
+        request: ModbusRequest
+        tags: list[int] = field(default_factory=list)
+
+    @classmethod
+    def plan_reads(
+        cls, tags: list[tuple[int, int, int]], function_code: int = 3, max_gap: int = 0
+    ) -> list[ReadBlock]:
+        """Merge tags into the fewest protocol legal read requests.
+
+        :param tags: list of (slave, address, count)
+        :param function_code: 1 (coils), 2 (discrete inputs), 3 (holding) or 4 (input registers)
+        :param max_gap: max number of unwanted registers/bits read to join 2 tags
+        :returns: list of ReadBlock, each with a request and the index of the tags it covers
+        :raises ModbusException: when function_code or count is not allowed
+
+        Tags may overlap and are allowed in any order, a request never
+        spans multiple slaves and never exceeds 125 registers/2000 bits.
+        """
+        if function_code not in cls.READ_PLAN_LIMITS:
+            raise ModbusException(f"Function code {function_code} cannot be planned!")
+        pdu_class, max_count = cls.READ_PLAN_LIMITS[function_code]
+        blocks: list[ModbusClientMixin.ReadBlock] = []
+        slave = start = end = -1
+        for inx in sorted(range(len(tags)), key=lambda i: tags[i]):
+            tag_slave, address, count = tags[inx]
+            if not 0 < count <= max_count:
+                raise ModbusException(f"Illegal count ({count}) in tag {inx}!")
+            tag_end = address + count
+            if (
+                tag_slave == slave
+                and address <= end + max_gap
+                and max(end, tag_end) - start <= max_count
+            ):
+                end = max(end, tag_end)
+                blocks[-1].tags.append(inx)
+                continue
+            if blocks:
+                blocks[-1].request.count = end - start
+            slave, start, end = tag_slave, address, tag_end
+            blocks.append(cls.ReadBlock(pdu_class(start, count, slave), [inx]))
+        if blocks:
+            blocks[-1].request.count = end - start
+        return blocks
+
+    @classmethod
+    def scatter_reads(
+        cls,
+        tags: list[tuple[int, int, int]],
+        blocks: list[ReadBlock],
+        responses: list[ModbusResponse],
+    ) -> list[list[int] | list[bool] | ModbusResponse]:
+        """Split responses from plan_reads() requests back to the tags.
+
+        :param tags: list of (slave, address, count) as given to plan_reads()
+        :param blocks: result from plan_reads()
+        :param responses: one response per block, in the same order
+        :returns: registers/bits per tag, in tag order,
+                  a tag covered by a failed request gets the error response.
+        """
+        values: list = [None] * len(tags)
+        for block, response in zip(blocks, responses):
+            if response.isError():
+                for inx in block.tags:
+                    values[inx] = response
+                continue
+            if isinstance(block.request, pdu_bit_read.ReadBitsRequestBase):
+                data = response.bits
+            else:
+                data = response.registers
+            for inx in block.tags:
+                _slave, address, count = tags[inx]
+                offset = address - block.request.address
+                values[inx] = data[offset : offset + count]
+        return values
@@ -48,6 +48,9 @@ class ModbusClientProtocol(ModbusProtocol):
         self.transaction = ModbusTransactionManager(
             self, retries=retries, retry_on_empty=retry_on_empty
         )
+        self.bus_timing = None
+        self.stats = None
+        self.responses = 0  # matched responses, shows the connection is alive
 
     def _handle_response(self, reply, **_kwargs):
         """Handle the processed response and link to correct deferred."""
@@ -55,6 +58,7 @@ class ModbusClientProtocol(ModbusProtocol):
             tid = reply.transaction_id
             if handler := self.transaction.getTransaction(tid):
                 if not handler.done():
+                    self.responses += 1
                     handler.set_result(reply)
             else:
                 Log.debug("Unrequested message: {}", reply, ":str")
@@ -71,6 +75,8 @@ class ModbusClientProtocol(ModbusProtocol):
     def callback_disconnected(self, exc: Exception | None) -> None:
         """Call when connection is lost."""
         Log.debug("callback_disconnected called: {}", exc)
+        if self.bus_timing:
+            self.bus_timing.cancel()
         if self.on_connect_callback:
             self.loop.call_soon(self.on_connect_callback, False)
 
@@ -79,9 +85,27 @@ class ModbusClientProtocol(ModbusProtocol):
 
         returns number of bytes consumed
         """
+        if self.bus_timing:
+            self.bus_timing.received()
+        if not (stats := self.stats):
+            self.framer.processIncomingPacket(data, self._handle_response, slave=0)
+            return len(data)
+        stats.bytes_in += len(data)
+        crc_errors = self.framer.message_handler.crc_errors
         self.framer.processIncomingPacket(data, self._handle_response, slave=0)
+        stats.crc_errors += self.framer.message_handler.crc_errors - crc_errors
         return len(data)
 
+    def callback_frame_end(self) -> None:
+        """Call when the line has been silent for a frame gap."""
+        if self.framer._buffer:  # pylint: disable=protected-access
+            Log.debug(
+                "Frame gap, discarding partial frame {}",
+                self.framer._buffer,  # pylint: disable=protected-access
+                ":hex",
+            )
+            self.framer.resetFrame()
+
     def __str__(self):
         """Build a string representation of the connection.
 
@@ -1,15 +1,21 @@
 """Modbus client async serial communication."""
 from __future__ import annotations
 
+import asyncio
+import os
+import select
 import time
+from collections import deque
+from collections.abc import Callable
 from functools import partial
 from typing import TYPE_CHECKING, Any
 
 from pymodbus.client.base import ModbusBaseClient, ModbusBaseSyncClient
-from pymodbus.exceptions import ConnectionException
+from pymodbus.exceptions import ConnectionException, ModbusException, ModbusIOException
 from pymodbus.framer import FramerType
 from pymodbus.logging import Log
 from pymodbus.transport import CommType
+from pymodbus.transport.serialtransport import serial_timing
 from pymodbus.utilities import ModbusTransactionState
 
 
@@ -23,6 +29,251 @@ except ImportError:
         # type checkers do not understand the Raise RuntimeError in __init__()
         import serial
 
+
+class ModbusBusTiming:
+    """RTU bus timing for the async serial client.
+
+    Keeps the (monotonic, loop.time()) time the bus is free, and
+    enforces the 3.5 char inter-frame gap before sending a request.
+
+    Received data rearms a frame end timer, when the line has been
+    silent for frame_gap, bytes left in the framer are a partial
+    (or corrupt) frame and are discarded, so the next frame starts
+    in sync instead of being appended to garbage.
+
+    t1.5 and t3.5 are calculated by serial_timing().
+    """
+
+    def __init__(
+        self,
+        baudrate: int = 19200,
+        bytesize: int = 8,
+        parity: str = "N",
+        stopbits: float = 1,
+        frame_gap: float | None = None,
+    ) -> None:
+        """Initialize bus timing.
+
+        :param baudrate: Bits per second.
+        :param bytesize: Number of bits per byte 7-8.
+        :param parity: 'E'ven, 'O'dd or 'N'one
+        :param stopbits: Number of stop bits 1, 1.5, 2.
+        :param frame_gap: silence (seconds) ending a frame, default t3.5
+        """
+        self.char_time, self.t1_5, self.t3_5 = serial_timing(
+            baudrate, bytesize, parity, stopbits
+        )
+        self.frame_gap = max(frame_gap or 0, self.t3_5)
+        self.bus_free = 0.0
+        self.last_rx = 0.0
+        self.on_frame_end: Callable[[], None] | None = None
+        self._timer: asyncio.TimerHandle | None = None
+
+    async def wait(self) -> None:
+        """Wait until the inter-frame gap has passed."""
+        if (delay := self.bus_free - asyncio.get_running_loop().time()) > 0:
+            await asyncio.sleep(delay)
+
+    def sent(self, size: int) -> None:
+        """Register a frame written to the bus.
+
+        :param size: frame length in bytes
+        """
+        self.bus_free = (
+            asyncio.get_running_loop().time() + size * self.char_time + self.t3_5
+        )
+
+    def received(self) -> None:
+        """Register data received from the bus."""
+        loop = asyncio.get_running_loop()
+        self.last_rx = loop.time()
+        self.bus_free = max(self.bus_free, self.last_rx + self.t3_5)
+        if self.on_frame_end and not self._timer:
+            self._timer = loop.call_at(self.last_rx + self.frame_gap, self._check_gap)
+
+    def _check_gap(self) -> None:
+        """Call on_frame_end, when the line has been silent for frame_gap."""
+        loop = asyncio.get_running_loop()
+        if (end := self.last_rx + self.frame_gap) > loop.time():
+            self._timer = loop.call_at(end, self._check_gap)
+            return
+        self._timer = None
+        if self.on_frame_end:
+            self.on_frame_end()
+
+    def cancel(self) -> None:
+        """Cancel frame end timer."""
+        if self._timer:
+            self._timer.cancel()
+            self._timer = None
+
+
+class ModbusBusMaster:
+    """Multi-drop bus master for the async serial client.
+
+    Concurrent requests are queued per slave id and sent round robin,
+    one request per slave per turn, so a slow or offline slave only
+    delays its own requests.
+
+    A request not answered within the slave timeout is retried after
+    the other slaves have had their turn. When all retries fail, the
+    slave is marked offline: its queued and new requests fail at once
+    (ModbusIOException) for backoff seconds, after which a single probe
+    request is sent. The backoff doubles with each failed probe, up to
+    backoff_max, and is reset by a response.
+
+    Unlike :meth:`ModbusBaseClient.async_execute`, a timeout does not
+    close the connection, the other slaves on the line are still alive.
+    """
+
+    def __init__(
+        self,
+        client: ModbusBaseClient,
+        backoff: float = 1.0,
+        backoff_max: float = 60.0,
+    ) -> None:
+        """Initialize bus master.
+
+        :param client: async client owning the line
+        :param backoff: seconds a slave is skipped after failing all retries
+        :param backoff_max: maximum seconds a slave is skipped
+        """
+        self.client = client
+        self.backoff = backoff
+        self.backoff_max = backoff_max
+        self.timeouts: dict[int, float] = {}
+        self.offline: dict[int, tuple[float, float]] = {}
+        self.queues: dict[int, deque[list]] = {}
+        self.ready: deque[int] = deque()
+        self._task: asyncio.Task | None = None
+
+    def set_timeout(self, slave: int, timeout: float) -> None:
+        """Set response timeout for a slave (default: client timeout).
+
+        :param slave: slave id
+        :param timeout: seconds
+        """
+        self.timeouts[slave] = timeout
+
+    async def execute(self, request):
+        """Queue request and wait for the response.
+
+        :param request: request to send
+        :returns: response (None for broadcast)
+        :raises ModbusIOException: no response or slave offline.
+        """
+        slave = request.slave_id
+        loop = asyncio.get_running_loop()
+        if (offline := self.offline.get(slave)) and offline[0] > loop.time():
+            raise ModbusIOException(
+                f"slave {slave} offline, skipped for {offline[0] - loop.time():.1f}s"
+            )
+        future = loop.create_future()
+        if slave not in self.queues:
+            self.queues[slave] = deque()
+            self.ready.append(slave)
+        self.queues[slave].append([request, future, 0])
+        if not self._task:
+            self._task = asyncio.create_task(self._run())
+        if not (conn := self.client.stats):
+            return await future
+        stats = conn.request(slave, request.function_code)
+        conn.enqueue()
+        start = time.perf_counter()
+        try:
+            resp = await future
+        except Exception:
+            stats.errors += 1
+            raise
+        finally:
+            conn.dequeue()
+        stats.done(start, resp)
+        return resp
+
+    async def _run(self) -> None:
+        """Send queued requests, round robin between slaves."""
+        try:
+            while self.ready:
+                slave = self.ready.popleft()
+                queue = self.queues[slave]
+                entry = queue.popleft()
+                if not entry[1].done():
+                    try:
+                        await self._poll(slave, entry, queue)
+                    except Exception as exc:  # pylint: disable=broad-except
+                        Log.error("Bus master failed polling slave {}: {}", slave, exc)
+                        if not entry[1].done():
+                            entry[1].set_exception(exc)
+                if queue:
+                    self.ready.append(slave)
+                else:
+                    del self.queues[slave]
+        finally:
+            self._task = None
+
+    async def _poll(self, slave: int, entry: list, queue: deque) -> None:
+        """Send one request and handle the response/timeout."""
+        request, future, attempt = entry
+        ctx = self.client.ctx
+        request.transaction_id = ctx.transaction.getNextTID()
+        packet = ctx.framer.buildPacket(request)
+        response = self.client.build_response(request.transaction_id)
+        stats = None
+        try:
+            ctx.framer.resetFrame()
+            if ctx.bus_timing:
+                await ctx.bus_timing.wait()
+            ctx.send(packet)
+            if ctx.bus_timing:
+                ctx.bus_timing.sent(len(packet))
+            if conn := self.client.stats:
+                conn.bytes_out += len(packet)
+                stats = conn.requests.get((slave, request.function_code))
+            if self.client.broadcast_enable and not slave:
+                future.set_result(None)
+                return
+            timeout = self.timeouts.get(slave, ctx.comm_params.timeout_connect)
+            resp = await asyncio.wait_for(response, timeout=timeout)
+            if resp.slave_id == slave or not resp.slave_id:
+                self.offline.pop(slave, None)
+                if not future.done():
+                    future.set_result(resp)
+                return
+            Log.warning("Response from slave {} while polling {}", resp.slave_id, slave)
+        except asyncio.exceptions.TimeoutError:
+            if stats:
+                stats.timeouts += 1
+        except ModbusException as exc:
+            if not future.done():
+                future.set_exception(exc)
+            return
+        finally:
+            # a response removes the transaction, anything else must too.
+            ctx.transaction.delTransaction(request.transaction_id)
+        retries = 0 if slave in self.offline else self.client.retries
+        if attempt < retries:
+            entry[2] += 1
+            queue.appendleft(entry)
+            if stats:
+                stats.retries += 1
+            return
+        self._set_offline(slave)
+        for _request, waiter, _attempt in (entry, *queue):
+            if not waiter.done():
+                waiter.set_exception(
+                    ModbusIOException(f"ERROR: No response from slave {slave}")
+                )
+        queue.clear()
+
+    def _set_offline(self, slave: int) -> None:
+        """Skip slave, with exponential backoff."""
+        backoff = self.backoff
+        if offline := self.offline.get(slave):
+            backoff = min(offline[1] * 2, self.backoff_max)
+        Log.warning("Slave {} not responding, skipped for {}s", slave, backoff)
+        self.offline[slave] = (asyncio.get_running_loop().time() + backoff, backoff)
+
+
 class AsyncModbusSerialClient(ModbusBaseClient):
     """**AsyncModbusSerialClient**.
 
@@ -37,6 +288,9 @@ class AsyncModbusSerialClient(ModbusBaseClient):
     :param parity: 'E'ven, 'O'dd or 'N'one
     :param stopbits: Number of stop bits 1, 1.5, 2.
     :param handle_local_echo: Discard local echo from dongle.
+    :param bus_timing: True to enforce the RTU inter-frame gap (:class:`ModbusBusTiming`).
+    :param frame_gap: Silence in seconds ending a frame (minimum t3.5), None to not discard partial frames.
+    :param bus_master: True to schedule requests fairly between slaves (:class:`ModbusBusMaster`).
 
     Common optional parameters:
 
@@ -51,6 +305,18 @@ class AsyncModbusSerialClient(ModbusBaseClient):
     :param no_resend_on_retry: Do not resend request when retrying due to missing response.
     :param kwargs: Experimental parameters.
 
+    With the RTU framer and bus_timing=True, the client waits the 3.5 char
+    inter-frame gap (:class:`ModbusBusTiming`) before sending a request.
+    Setting frame_gap (implies bus_timing) also discards partial frames when
+    the line has been silent for frame_gap. USB-serial adapters deliver data
+    in chunks (latency timer, typically 1-16 ms), use a frame_gap larger
+    than the adapter latency.
+
+    With bus_master=True, concurrent requests (e.g. :mod:`asyncio.gather`) for
+    many slaves are interleaved, and an offline slave is skipped instead of
+    stalling the line, per slave timeouts are set with
+    `client.bus_master.set_timeout(slave, seconds)`.
+
     Example::
 
         from pymodbus.client import AsyncModbusSerialClient
@@ -73,6 +339,9 @@ class AsyncModbusSerialClient(ModbusBaseClient):
         bytesize: int = 8,
         parity: str = "N",
         stopbits: int = 1,
+        bus_timing: bool = False,
+        frame_gap: float | None = None,
+        bus_master: bool = False,
         **kwargs: Any,
     ) -> None:
         """Initialize Asyncio Modbus Serial Client."""
@@ -92,6 +361,19 @@ class AsyncModbusSerialClient(ModbusBaseClient):
             stopbits=stopbits,
             **kwargs,
         )
+        if framer == FramerType.RTU and (bus_timing or frame_gap is not None):
+            self.ctx.bus_timing = ModbusBusTiming(
+                baudrate, bytesize, parity, stopbits, frame_gap
+            )
+            if frame_gap is not None:
+                self.ctx.bus_timing.on_frame_end = self.ctx.callback_frame_end
+        self.bus_master = ModbusBusMaster(self) if bus_master else None
+
+    async def async_execute(self, request):
+        """Execute requests asynchronously."""
+        if self.bus_master:
+            return await self.bus_master.execute(request)
+        return await super().async_execute(request)
 
     def close(self, reconnect: bool = False) -> None:
         """Close connection."""
@@ -174,19 +456,16 @@ class ModbusSerialClient(ModbusBaseSyncClient):
 
         self.last_frame_end = None
 
-        self._t0 = float(1 + bytesize + stopbits) / baudrate
+        self._t0, t1_5, t3_5 = serial_timing(baudrate, bytesize, parity, stopbits)
 
         # Check every 4 bytes / 2 registers if the reading is ready
         self._recv_interval = self._t0 * 4
         # Set a minimum of 1ms for high baudrates
         self._recv_interval = max(self._recv_interval, 0.001)
 
-        if baudrate > 19200:
-            self.silent_interval = 1.75 / 1000  # ms
-        else:
-            self.inter_byte_timeout = 1.5 * self._t0
-            self.silent_interval = 3.5 * self._t0
-        self.silent_interval = round(self.silent_interval, 6)
+        if baudrate <= 19200:
+            self.inter_byte_timeout = t1_5
+        self.silent_interval = round(t3_5, 6)
 
     @property
     def connected(self):
@@ -246,7 +525,7 @@ class ModbusSerialClient(ModbusBaseSyncClient):
         return 0
 
     def _wait_for_data(self):
-        """Wait for data."""
+        """Wait for data (polling, used without file descriptor)."""
         size = 0
         more_data = False
         condition = partial(
@@ -264,11 +543,48 @@ class ModbusSerialClient(ModbusBaseSyncClient):
             time.sleep(self._recv_interval)
         return size
 
+    def _fileno(self):
+        """Return file descriptor usable with select(), None if not available."""
+        if os.name == "nt":
+            return None
+        try:
+            fileno = self.socket.fileno()  # type: ignore[union-attr]
+        except Exception:  # pylint: disable=broad-exception-caught
+            # url handlers (e.g. loop://) do not have a file descriptor.
+            return None
+        # only a real descriptor can be passed to select().
+        return fileno if isinstance(fileno, int) else None
+
+    def _recv_select(self, fileno, size):
+        """Read data, sleeping in select() until data arrives.
+
+        With size=None, the frame ends when the line is silent for the
+        frame gap, otherwise when size bytes are received or at timeout.
+        """
+        data = b""
+        gap = max(self.silent_interval, self._recv_interval)
+        deadline = time.monotonic() + self.comm_params.timeout_connect
+        while size is None or len(data) < size:
+            wait = deadline - time.monotonic()
+            if data and size is None:
+                wait = min(wait, gap)
+            if wait <= 0 or not select.select([fileno], [], [], wait)[0]:
+                break
+            count = self._in_waiting() or 1
+            if size is not None:
+                count = min(count, size - len(data))
+            if not (chunk := self.socket.read(count)):  # type: ignore[union-attr]
+                break
+            data += chunk
+        return data
+
     def recv(self, size):
         """Read data from the underlying descriptor."""
         super().recv(size)
         if not self.socket:
             raise ConnectionException(str(self))
+        if (fileno := self._fileno()) is not None:
+            return self._recv_select(fileno, size)
         if size is None:
             size = self._wait_for_data()
         if size > self._in_waiting():
@@ -36,6 +36,7 @@ class AsyncModbusTcpClient(ModbusBaseClient):
     :param reconnect_delay_max: Maximum delay in seconds.milliseconds before reconnecting.
     :param on_reconnect_callback: Function that will be called just before a reconnection attempt.
     :param no_resend_on_retry: Do not resend request when retrying due to missing response.
+    :param max_inflight: Max number of requests sent without waiting for the response.
     :param kwargs: Experimental parameters.
 
     Example::
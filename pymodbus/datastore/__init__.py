@@ -1,21 +1,27 @@
 """Datastore."""
 
 __all__ = [
+    "ModbusArrayDataBlock",
     "ModbusBaseSlaveContext",
     "ModbusSequentialDataBlock",
     "ModbusSparseDataBlock",
     "ModbusSlaveContext",
     "ModbusServerContext",
+    "ModbusSharedMemoryDataBlock",
+    "ModbusSharedServerContext",
     "ModbusSimulatorContext",
 ]
 
 from pymodbus.datastore.context import (
     ModbusBaseSlaveContext,
     ModbusServerContext,
+    ModbusSharedServerContext,
     ModbusSlaveContext,
 )
 from pymodbus.datastore.simulator import ModbusSimulatorContext
 from pymodbus.datastore.store import (
+    ModbusArrayDataBlock,
     ModbusSequentialDataBlock,
+    ModbusSharedMemoryDataBlock,
     ModbusSparseDataBlock,
 )
@@ -3,7 +3,14 @@
 from __future__ import annotations
 
 # pylint: disable=missing-type-doc
-from pymodbus.datastore.store import ModbusSequentialDataBlock
+import sys
+from collections.abc import Callable
+from multiprocessing import resource_tracker, shared_memory
+
+from pymodbus.datastore.store import (
+    ModbusSequentialDataBlock,
+    ModbusSharedMemoryDataBlock,
+)
 from pymodbus.exceptions import NoSuchSlaveException
 from pymodbus.logging import Log
 
@@ -40,14 +47,21 @@ class ModbusBaseSlaveContext:
         """
         return self.getValues(fc_as_hex, address, count)
 
-    async def async_setValues(self, fc_as_hex: int, address: int, values: list[int | bool]) -> None:
+    async def async_setValues(
+        self, fc_as_hex: int, address: int, values: list[int | bool]
+    ) -> list[int | bool] | None:
         """Set the datastore with the supplied values.
 
         :param fc_as_hex: The function we are working with
         :param address: The starting address
         :param values: The new values to be set
+
+        Datastores that know the values stored (e.g. a remote device
+        echoing a single write) return them, None lets the caller read
+        them back.
         """
         self.setValues(fc_as_hex, address, values)
+        return None
 
     def getValues(self, fc_as_hex: int, address: int, count: int = 1) -> list[int | bool | None]:
         """Get `count` values from datastore.
@@ -90,6 +104,10 @@ class ModbusSlaveContext(ModbusBaseSlaveContext):
 
         Default is False.
 
+    .. attribute:: write_listeners
+
+       Called as listener(context, fc_as_hex, address, count) after
+       setValues(), e.g. used by the server response cache.
     """
 
     def __init__(self, *_args, **kwargs):
@@ -100,6 +118,7 @@ class ModbusSlaveContext(ModbusBaseSlaveContext):
         self.store["i"] = kwargs.get("ir", ModbusSequentialDataBlock.create())
         self.store["h"] = kwargs.get("hr", ModbusSequentialDataBlock.create())
         self.zero_mode = kwargs.get("zero_mode", False)
+        self.write_listeners: list[Callable] = []
 
     def __str__(self):
         """Return a string representation of the context.
@@ -123,7 +142,8 @@ class ModbusSlaveContext(ModbusBaseSlaveContext):
         """
         if not self.zero_mode:
             address += 1
-        Log.debug("validate: fc-[{}] address-{}: count-{}", fc_as_hex, address, count)
+        if Log.hot_path:
+            Log.debug("validate: fc-[{}] address-{}: count-{}", fc_as_hex, address, count)
         return self.store[self.decode(fc_as_hex)].validate(address, count)
 
     def getValues(self, fc_as_hex, address, count=1):
@@ -136,7 +156,8 @@ class ModbusSlaveContext(ModbusBaseSlaveContext):
         """
         if not self.zero_mode:
             address += 1
-        Log.debug("getValues: fc-[{}] address-{}: count-{}", fc_as_hex, address, count)
+        if Log.hot_path:
+            Log.debug("getValues: fc-[{}] address-{}: count-{}", fc_as_hex, address, count)
         return self.store[self.decode(fc_as_hex)].getValues(address, count)
 
     def setValues(self, fc_as_hex, address, values):
@@ -146,10 +167,12 @@ class ModbusSlaveContext(ModbusBaseSlaveContext):
         :param address: The starting address
         :param values: The new values to be set
         """
-        if not self.zero_mode:
-            address += 1
-        Log.debug("setValues[{}] address-{}: count-{}", fc_as_hex, address, len(values))
-        self.store[self.decode(fc_as_hex)].setValues(address, values)
+        store_address = address if self.zero_mode else address + 1
+        if Log.hot_path:
+            Log.debug("setValues[{}] address-{}: count-{}", fc_as_hex, store_address, len(values))
+        self.store[self.decode(fc_as_hex)].setValues(store_address, values)
+        for listener in self.write_listeners:
+            listener(self, fc_as_hex, address, len(values))
 
     def register(self, function_code, fc_as_hex, datablock=None):
         """Register a datablock with the slave context.
@@ -243,3 +266,107 @@ class ModbusServerContext:
         """Define slaves."""
         # Python3 now returns keys() as iterable
         return list(self._slaves.keys())
+
+
+class ModbusSharedServerContext(ModbusServerContext):
+    """Server context with all slave datastores in one shared memory segment.
+
+    Every process using the context (e.g. the workers started by
+    StartMultiProcessTcpServer) reads and writes the same registers.
+
+    Each slave has coils/discrete inputs (1 byte/value) and holding/input
+    registers (2 bytes/value) of "size" values, starting at address 0.
+
+    The context is picklable, unpickling attaches to the existing segment.
+    The process that created the segment must call unlink() when done.
+
+    example::
+
+        context = ModbusSharedServerContext(slaves=[1, 2], size=1000)
+        StartMultiProcessTcpServer(workers=4, context=context, address=("", 502))
+        context.unlink()
+    """
+
+    def __init__(
+        self, slaves=None, size=65536, zero_mode=False, name=None, create=True
+    ):  # pylint: disable=too-many-arguments
+        """Initialize a new instance.
+
+        :param slaves: list of slave ids, None to use a single context
+        :param size: number of values in each datastore
+        :param zero_mode: see ModbusSlaveContext
+        :param name: name of the shared memory segment (None to generate one)
+        :param create: create the segment (True) or attach to it (False)
+        """
+        self.slave_ids = list(slaves) if slaves is not None else [0]
+        self.size = size
+        self.zero_mode = zero_mode
+        slave_bytes = 6 * size
+        if create:
+            self.shm = shared_memory.SharedMemory(
+                name=name, create=True, size=slave_bytes * len(self.slave_ids)
+            )
+        else:
+            self.shm = self._attach(name)
+        self.owner = create
+        contexts = {}
+        for inx, slave_id in enumerate(self.slave_ids):
+            buf = self.shm.buf[inx * slave_bytes : (inx + 1) * slave_bytes]
+            contexts[slave_id] = ModbusSlaveContext(
+                di=ModbusSharedMemoryDataBlock(0, buf[:size], "B"),
+                co=ModbusSharedMemoryDataBlock(0, buf[size : 2 * size], "B"),
+                hr=ModbusSharedMemoryDataBlock(0, buf[2 * size : 4 * size], "H"),
+                ir=ModbusSharedMemoryDataBlock(0, buf[4 * size :], "H"),
+                zero_mode=zero_mode,
+            )
+        if slaves is None:
+            super().__init__(slaves=contexts[0], single=True)
+        else:
+            super().__init__(slaves=contexts, single=False)
+
+    @staticmethod
+    def _attach(name):
+        """Attach to an existing segment, without tracking it.
+
+        Only the creator may register the segment with the resource
+        tracker, otherwise the tracker of an attaching process warns
+        about a leaked segment and unlinks it at exit. Unregistering
+        after attaching is not an option, spawn/forkserver workers share
+        the tracker of the creator and would remove its registration.
+        """
+        if sys.version_info >= (3, 13):
+            return shared_memory.SharedMemory(  # pylint: disable=unexpected-keyword-arg
+                name=name, track=False
+            )
+        register = resource_tracker.register
+        resource_tracker.register = lambda _name, _rtype: None  # type: ignore[assignment]
+        try:
+            return shared_memory.SharedMemory(name=name)
+        finally:
+            resource_tracker.register = register
+
+    def __reduce__(self):
+        """Pickle as a reference to the shared memory segment."""
+        return (
+            self.__class__,
+            (
+                self.slave_ids if not self.single else None,
+                self.size,
+                self.zero_mode,
+                self.shm.name,
+                False,
+            ),
+        )
+
+    def close(self):
+        """Release the memory mapping of this process."""
+        for _slave_id, context in self:
+            for datablock in context.store.values():
+                datablock.values.release()
+        self.shm.close()
+
+    def unlink(self):
+        """Close and delete the shared memory segment (creator only)."""
+        self.close()
+        if self.owner:
+            self.shm.unlink()
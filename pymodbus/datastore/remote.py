@@ -1,7 +1,12 @@
 """Remote datastore."""
+from __future__ import annotations
+
+import asyncio
+
 from pymodbus.datastore import ModbusBaseSlaveContext
-from pymodbus.exceptions import NotImplementedException
+from pymodbus.exceptions import ModbusException, NotImplementedException
 from pymodbus.logging import Log
+from pymodbus.pdu import ModbusResponse
 
 
 # ---------------------------------------------------------------------------#
@@ -127,3 +132,155 @@ class RemoteSlaveContext(ModbusBaseSlaveContext):
         else:
             return result
         return None
+
+
+class AsyncRemoteSlaveContext(ModbusBaseSlaveContext):
+    """Remote datastore, for async clients.
+
+    Intended for gateways/forwarders where many masters poll the same
+    remote device:
+
+    - reads received in the same event loop iteration (or within `delay`
+      seconds) are coalesced into the fewest upstream requests, using
+      the client read_tags(),
+    - identical reads share one upstream request while it is in flight,
+    - upstream requests are sent concurrently, so a client created with
+      max_inflight > 1 pipelines them,
+    - writes are forwarded directly.
+
+    Upstream errors are raised as ModbusException, which the server
+    returns as SlaveFailure.
+
+    :param client: connected async client
+    :param slave: slave id of the remote device
+    :param max_gap: max number of unwanted registers/bits read to join 2 reads
+    :param delay: seconds to wait for more reads, before sending upstream
+    """
+
+    _write_callbacks = {
+        0x05: ("write_coil", True),
+        0x0F: ("write_coils", False),
+        0x06: ("write_register", True),
+        0x10: ("write_registers", False),
+        0x16: ("write_registers", False),
+        0x17: ("write_registers", False),
+    }
+
+    def __init__(self, client, slave: int = 0, max_gap: int = 0, delay: float = 0.0):
+        """Initialize the datastore."""
+        self._client = client
+        self.slave = slave
+        self.max_gap = max_gap
+        self.delay = delay
+        self._reads: dict[tuple[int, int, int], asyncio.Future] = {}
+        self._batch: dict[int, list[tuple[int, int, asyncio.Future]]] = {}
+        self._tasks: set[asyncio.Task] = set()
+
+    def __str__(self):
+        """Return a string representation of the context.
+
+        :returns: A string representation of the context
+        """
+        return f"Async Remote Slave Context({self._client})"
+
+    def reset(self):
+        """Forget collected and in flight reads.
+
+        The remote device is not reset. Reads not yet sent upstream fail
+        with ModbusException, reads in flight still get their response,
+        but later reads do not join them.
+        """
+        batch, self._batch = self._batch, {}
+        self._reads = {}
+        for reads in batch.values():
+            for _address, _count, future in reads:
+                if not future.done():
+                    future.set_exception(ModbusException("datastore reset"))
+
+    def validate(self, fc_as_hex, address, count=1):
+        """Validate the request to make sure it is in range.
+
+        Only checks the request is inside the modbus address space, the
+        remote device validates the rest.
+        """
+        return (
+            (fc_as_hex in self._fx_mapper or fc_as_hex in self._write_callbacks)
+            and 0 <= address
+            and address + count <= 0x10000
+        )
+
+    async def async_getValues(self, fc_as_hex, address, count=1):
+        """Get values from remote device (coalesced).
+
+        :param fc_as_hex: The function we are working with
+        :param address: The starting address
+        :param count: The number of values to retrieve
+        :returns: The requested values
+        :raises ModbusException: if the remote device returns an error
+        """
+        if fc_as_hex in self._write_callbacks:
+            fc_as_hex = 0x01 if fc_as_hex in {0x05, 0x0F} else 0x03
+        key = (fc_as_hex, address, count)
+        if (future := self._reads.get(key)) is None:
+            future = self._reads[key] = asyncio.get_running_loop().create_future()
+            if not self._batch:
+                asyncio.get_running_loop().call_later(self.delay, self._flush)
+            self._batch.setdefault(fc_as_hex, []).append((address, count, future))
+        # shield, a cancelled request must not cancel other waiters.
+        return await asyncio.shield(future)
+
+    async def async_setValues(self, fc_as_hex, address, values):
+        """Set values in the remote device.
+
+        :param fc_as_hex: The function we are working with
+        :param address: The starting address
+        :param values: The new values to be set
+        :returns: for single writes, the value echoed by the remote device
+        :raises ModbusException: if the remote device returns an error
+        """
+        if fc_as_hex not in self._write_callbacks:
+            raise ValueError(f"setValues() called with an non-write function code {fc_as_hex}")
+        method, single = self._write_callbacks[fc_as_hex]
+        # later reads must not join reads sent before the write.
+        store = self.decode(fc_as_hex)
+        for key in [key for key in self._reads if self.decode(key[0]) == store]:
+            del self._reads[key]
+        response = await getattr(self._client, method)(
+            address, values[0] if single else values, slave=self.slave
+        )
+        if response.isError():
+            raise ModbusException(f"Remote device returned {response}")
+        return [response.value] if single else None
+
+    def _flush(self):
+        """Send collected reads upstream."""
+        batch, self._batch = self._batch, {}
+        for fc_as_hex, reads in batch.items():
+            task = asyncio.create_task(self._read(fc_as_hex, reads))
+            self._tasks.add(task)
+            task.add_done_callback(self._tasks.discard)
+
+    async def _read(self, fc_as_hex, reads):
+        """Read one batch, and resolve waiting futures."""
+        tags = [(self.slave, address, count) for address, count, _future in reads]
+        try:
+            values = await self._client.read_tags(tags, fc_as_hex, self.max_gap)
+            if len(tags) > 1:
+                # a merged request may fail where the single ones do not.
+                for inx, value in enumerate(values):
+                    if isinstance(value, ModbusResponse):
+                        values[inx] = (await self._client.read_tags([tags[inx]], fc_as_hex))[0]
+        except Exception as exc:  # pylint: disable=broad-except
+            values = [exc] * len(tags)
+        for (address, count, future), value in zip(reads, values):
+            key = (fc_as_hex, address, count)
+            if self._reads.get(key) is future:
+                del self._reads[key]
+            if future.done():
+                continue
+            if isinstance(value, Exception):
+                future.set_exception(value)
+            elif isinstance(value, ModbusResponse):
+                future.set_exception(ModbusException(f"Remote device returned {value}"))
+            else:
+                future.set_result(value)
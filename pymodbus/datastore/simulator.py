@@ -1,14 +1,19 @@
 """Pymodbus ModbusSimulatorContext."""
 from __future__ import annotations
 
+import asyncio
 import dataclasses
 import random
 import struct
+from array import array
+from bisect import bisect_left, insort
 from collections.abc import Callable
 from datetime import datetime
+from itertools import accumulate
 from typing import Any
 
 from pymodbus.datastore.context import ModbusBaseSlaveContext
+from pymodbus.logging import Log
 
 
 WORD_SIZE = 16
@@ -40,6 +45,223 @@ class Cell:
     count_write: int = 0
 
 
+class RangeCounter:
+    """Per cell counters, incremented a range at a time.
+
+    Kept as a difference array, so counting a read/write of n cells costs
+    2 updates, the counters are computed (and cached until the next range
+    update) when looked at. Setting a single counter updates the cache.
+    """
+
+    def __init__(self, size: int) -> None:
+        """Initialize size counters."""
+        self.marks = array("i", bytes(4 * (size + 1)))
+        self.counts: array | None = None
+
+    def add(self, start: int, stop: int) -> None:
+        """Count cells in range(start, stop)."""
+        self.marks[start] += 1
+        self.marks[stop] -= 1
+        self.counts = None
+
+    def __getitem__(self, inx: int) -> int:
+        """Return counter."""
+        if self.counts is None:
+            self.counts = array("I", accumulate(self.marks[:-1]))
+        return self.counts[inx]
+
+    def __setitem__(self, inx: int, value: int) -> None:
+        """Set counter."""
+        delta = value - self[inx]
+        self.marks[inx] += delta
+        self.marks[inx + 1] -= delta
+        self.counts[inx] = value  # type: ignore[index]
+
+
+class CellRef:
+    """A single cell in a CellArray, with the attributes of Cell."""
+
+    __slots__ = ("cells", "inx")
+
+    def __init__(self, cells: CellArray, inx: int) -> None:
+        """Initialize."""
+        self.cells = cells
+        self.inx = inx
+
+    def __repr__(self) -> str:
+        """Return register number."""
+        return f"register {self.inx}"
+
+    @property
+    def type(self) -> int:
+        """Return cell type."""
+        return self.cells.types[self.inx]
+
+    @type.setter
+    def type(self, value: int) -> None:
+        self.cells.types[self.inx] = value
+
+    @property
+    def access(self) -> bool:
+        """Return True if writable."""
+        return bool(self.cells.access[self.inx])
+
+    @access.setter
+    def access(self, value: bool) -> None:
+        self.cells.access[self.inx] = bool(value)
+
+    @property
+    def value(self) -> int:
+        """Return register value."""
+        return self.cells.values[self.inx]
+
+    @value.setter
+    def value(self, value: int) -> None:
+        self.cells.values[self.inx] = value & 0xFFFF
+
+    @property
+    def action(self) -> int:
+        """Return action id (0 = none)."""
+        return self.cells.actions.get(self.inx, 0)
+
+    @action.setter
+    def action(self, value: int) -> None:
+        self.cells.set_action(self.inx, value)
+
+    @property
+    def action_kwargs(self) -> dict[str, Any] | None:
+        """Return action arguments."""
+        return self.cells.action_kwargs.get(self.inx)
+
+    @action_kwargs.setter
+    def action_kwargs(self, value: dict[str, Any] | None) -> None:
+        if value:
+            self.cells.action_kwargs[self.inx] = value
+        else:
+            self.cells.action_kwargs.pop(self.inx, None)
+
+    @property
+    def count_read(self) -> int:
+        """Return number of reads."""
+        return self.cells.count_read[self.inx]
+
+    @count_read.setter
+    def count_read(self, value: int) -> None:
+        self.cells.count_read[self.inx] = value
+
+    @property
+    def count_write(self) -> int:
+        """Return number of writes."""
+        return self.cells.count_write[self.inx]
+
+    @count_write.setter
+    def count_write(self, value: int) -> None:
+        self.cells.count_write[self.inx] = value
+
+
+class CellArray:
+    """Cells stored as parallel arrays (structure of arrays).
+
+    Type, access and value are kept in arrays of 1, 1 and 2 bytes per
+    register, the read/write counters in RangeCounter, and actions (with
+    their kwargs) in sparse tables, with a sorted list of the registers
+    having an action.
+
+    Indexing returns a CellRef, which works like a Cell, so setup code and
+    actions can use registers[inx].value etc., while getValues/setValues
+    work directly on the arrays.
+    """
+
+    def __init__(self, size: int) -> None:
+        """Initialize size empty (invalid) cells."""
+        self.types = bytearray(size)
+        self.access = bytearray(size)
+        self.values = array("H", bytes(2 * size))
+        self.count_read = RangeCounter(size)
+        self.count_write = RangeCounter(size)
+        self.actions: dict[int, int] = {}
+        self.action_kwargs: dict[int, dict[str, Any]] = {}
+        self.action_list: list[int] = []
+        self.action_version = 0
+
+    def __len__(self) -> int:
+        """Return number of cells."""
+        return len(self.types)
+
+    def __getitem__(self, inx):
+        """Return CellRef (list of CellRef for a slice)."""
+        if isinstance(inx, slice):
+            return [CellRef(self, i) for i in range(*inx.indices(len(self)))]
+        if inx < 0:
+            inx += len(self)
+        if not 0 <= inx < len(self):
+            raise IndexError(f"register {inx} out of range")
+        return CellRef(self, inx)
+
+    def __setitem__(self, inx: int, cell) -> None:
+        """Copy cell (Cell or CellRef)."""
+        cell_type, access, value = cell.type, cell.access, cell.value
+        action, kwargs = cell.action, cell.action_kwargs
+        count_read, count_write = cell.count_read, cell.count_write
+        ref = CellRef(self, inx)
+        ref.type = cell_type
+        ref.access = access
+        ref.value = value
+        ref.action = action
+        ref.action_kwargs = kwargs
+        ref.count_read = count_read
+        ref.count_write = count_write
+
+    def __iter__(self):
+        """Iterate over cells."""
+        return (CellRef(self, i) for i in range(len(self)))
+
+    def repeat(self, start: int, stop: int, to_start: int, to_stop: int) -> None:
+        """Fill range(to_start, to_stop) with copies of range(start, stop).
+
+        The ranges must not overlap. Type, access and value are copied a
+        column at a time, actions and counters only where the source has them.
+        """
+        size, count = stop - start, to_stop - to_start
+        for column in (self.types, self.access, self.values):
+            pattern = column[start:stop]
+            column[to_start:to_stop] = (pattern * (count // size + 1))[:count]
+        for inx in self.actions_in(to_start, to_stop):
+            self.set_action(inx, 0)
+            self.action_kwargs.pop(inx, None)
+        for src in self.actions_in(start, stop):
+            action, kwargs = self.actions[src], self.action_kwargs.get(src)
+            for inx in range(to_start + src - start, to_stop, size):
+                self.set_action(inx, action)
+                if kwargs:
+                    self.action_kwargs[inx] = kwargs
+        for counter in (self.count_read, self.count_write):
+            for inx in range(to_start, to_stop):
+                if counter[inx]:
+                    counter[inx] = 0
+            for src in range(start, stop):
+                if value := counter[src]:
+                    for inx in range(to_start + src - start, to_stop, size):
+                        counter[inx] = value
+
+    def set_action(self, inx: int, action: int) -> None:
+        """Set (0 to remove) action of a cell."""
+        self.action_version += 1
+        if action:
+            if inx not in self.actions:
+                insort(self.action_list, inx)
+            self.actions[inx] = action
+        elif self.actions.pop(inx, None) is not None:
+            del self.action_list[bisect_left(self.action_list, inx)]
+
+    def actions_in(self, start: int, stop: int) -> list[int]:
+        """Return cells with an action in range(start, stop)."""
+        action_list = self.action_list
+        return action_list[
+            bisect_left(action_list, start) : bisect_left(action_list, stop)
+        ]
+
+
 class TextCell:  # pylint: disable=too-few-public-methods
     """A textual representation of a single cell."""
 
@@ -60,6 +282,7 @@ class Label:  # pylint: disable=too-many-instance-attributes
     """
 
     action: str = "action"
+    action_interval: str = "action interval"
     addr: str = "addr"
     any: str = "any"
     co_size: str = "co size"
@@ -236,12 +459,12 @@ class Setup:
             for i in (3, 6, 16, 22, 23):
                 self.runtime.fc_offset[i] = total_size
             total_size += size_hr
-        first_cell = Cell()
-        self.runtime.registers = [
-            dataclasses.replace(first_cell) for i in range(total_size)
-        ]
+        self.runtime.registers = CellArray(total_size)
         self.runtime.register_count = total_size
         self.runtime.type_exception = bool(Label.try_get(Label.type_exception, layout))
+        if (interval := float(layout.get(Label.action_interval, 0))) < 0:
+            raise RuntimeError(f'ERROR "{Label.action_interval}" {interval} illegal')
+        self.runtime.action_interval = interval
         defaults = Label.try_get(Label.defaults, layout)
         defaults_value = Label.try_get(Label.value, defaults)
         defaults_action = Label.try_get(Label.action, defaults)
@@ -317,15 +540,22 @@ class Setup:
             copy_end = addr[1]
             copy_inx = copy_start - 1
             addr_to = Label.try_get(Label.repeat_to, entry)
+            if copy_end < addr_to[0] or addr_to[1] < copy_start:
+                if addr_to[1] >= self.runtime.register_count:
+                    raise RuntimeError(
+                        f'Error section "{Label.repeat}" entry {entry} out of range'
+                    )
+                self.runtime.registers.repeat(
+                    copy_start, copy_end + 1, addr_to[0], addr_to[1] + 1
+                )
+                continue
             for inx in range(addr_to[0], addr_to[1] + 1):
                 copy_inx = copy_start if copy_inx >= copy_end else copy_inx + 1
                 if inx >= self.runtime.register_count:
                     raise RuntimeError(
                         f'Error section "{Label.repeat}" entry {entry} out of range'
                     )
-                self.runtime.registers[inx] = dataclasses.replace(
-                    self.runtime.registers[copy_inx]
-                )
+                self.runtime.registers[inx] = self.runtime.registers[copy_inx]
         del self.config[Label.repeat]
 
     def setup(self, config, custom_actions) -> None:
@@ -339,15 +569,24 @@ class Setup:
         }
         if custom_actions:
             actions.update(custom_actions)
+        batches = {
+            self.runtime.action_increment: self.runtime.batch_increment,
+            self.runtime.action_random: self.runtime.batch_random,
+            self.runtime.action_timestamp: self.runtime.batch_timestamp,
+            self.runtime.action_uptime: self.runtime.batch_uptime,
+        }
         self.runtime.action_name_to_id = {None: 0}
         self.runtime.action_id_to_name = [Label.none]
         self.runtime.action_methods = [None]
+        self.runtime.action_batches = [None]
         i = 1
         for key, method in actions.items():
             self.runtime.action_name_to_id[key] = i
             self.runtime.action_id_to_name.append(key)
             self.runtime.action_methods.append(method)
+            self.runtime.action_batches.append(batches.get(method))
             i += 1
+        self.runtime.read_actions = {self.runtime.action_name_to_id[Label.reset]}
         self.runtime.registerType_name_to_id = {
             Label.type_bits: CellType.BITS,
             Label.type_uint16: CellType.UINT16,
@@ -427,6 +666,7 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
                     },
                 },
                 "type exception": False,  --> return IO exception if read/write on non boundary
+                "action interval": 0,  --> >0 run actions every x seconds, instead of at each read
             },
             "invalid": [  --> List of invalid addresses, IO exception returned
                 51,                --> single register
@@ -472,7 +712,7 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
         self, config: dict[str, Any], custom_actions: dict[str, Callable] | None
     ) -> None:
         """Initialize."""
-        self.registers: list[Cell] = []
+        self.registers = CellArray(0)
         self.fc_offset: dict[int, int] = {}
         self.register_count = 0
         self.type_exception = False
@@ -481,6 +721,12 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
         self.action_methods: list[Callable] = []
         self.registerType_name_to_id: dict[str, int] = {}
         self.registerType_id_to_name: list[str] = []
+        self.action_interval = 0.0
+        self.action_batches: list[Callable | None] = []
+        self.read_actions: set[int] = set()
+        self._tick_batches: list[tuple[int, list[int]]] = []
+        self._tick_version = -1
+        self._action_task: asyncio.Task | None = None
         Setup(self).setup(config, custom_actions)
 
     # --------------------------------------------
@@ -539,27 +785,28 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
 
         :meta private:
         """
+        cells = self.registers
+        if not self.type_exception:
+            if CellType.INVALID in cells.types[address:end_address]:
+                return False
+            return not (fx_write and 0 in cells.access[address:end_address])
+        types = cells.types
         i = address
         while i < end_address:
-            reg = self.registers[i]
-            if fx_write and not reg.access or reg.type == CellType.INVALID:
+            if fx_write and not cells.access[i] or types[i] == CellType.INVALID:
                 return False
-            if not self.type_exception:
-                i += 1
-                continue
-            if reg.type == CellType.NEXT:
+            if types[i] == CellType.NEXT:
                 return False
-            if reg.type in (CellType.BITS, CellType.UINT16):
+            if types[i] in (CellType.BITS, CellType.UINT16):
                 i += 1
-            elif reg.type in (CellType.UINT32, CellType.FLOAT32):
+            elif types[i] in (CellType.UINT32, CellType.FLOAT32):
                 if i + 1 >= end_address:
                     return False
                 i += 2
             else:
                 i += 1
-                while i < end_address:
-                    if self.registers[i].type == CellType.NEXT:
-                        i += 1
+                while i < end_address and types[i] == CellType.NEXT:
+                    i += 1
         return True
 
     def validate(self, func_code, address, count=1):
@@ -573,7 +820,7 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
             address = int(address / 16)
 
         real_address = self.fc_offset[func_code] + address
-        if real_address < 0 or real_address > self.register_count:
+        if real_address < 0 or real_address + count > self.register_count:
             return False
 
         fx_write = func_code in self._write_func_code
@@ -584,59 +831,128 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
 
         :meta private:
         """
-        result = []
         if func_code not in self._bits_func_code:
             real_address = self.fc_offset[func_code] + address
-            for i in range(real_address, real_address + count):
-                reg = self.registers[i]
-                kwargs = reg.action_kwargs if reg.action_kwargs else {}
-                if reg.action:
-                    self.action_methods[reg.action](self.registers, i, reg, **kwargs)
-                self.registers[i].count_read += 1
-                result.append(reg.value)
+            end_address = real_address + count
         else:
             # bit access
             real_address = self.fc_offset[func_code] + int(address / 16)
             bit_index = address % 16
-            reg_count = int((count + bit_index + 15) / 16)
-            for i in range(real_address, real_address + reg_count):
-                reg = self.registers[i]
-                if reg.action:
-                    kwargs = reg.action_kwargs or {}
-                    self.action_methods[reg.action](
-                        self.registers, i, reg, **kwargs
-                    )
-                self.registers[i].count_read += 1
-                while count and bit_index < 16:
-                    result.append(bool(reg.value & (2**bit_index)))
-                    count -= 1
-                    bit_index += 1
-                bit_index = 0
+            end_address = real_address + int((count + bit_index + 15) / 16)
+        cells = self.registers
+        if cells.action_list:
+            self.run_actions(real_address, end_address)
+        cells.count_read.add(real_address, end_address)
+        if func_code not in self._bits_func_code:
+            return cells.values[real_address:end_address].tolist()
+        result = []
+        for value in cells.values[real_address:end_address]:
+            while count and bit_index < 16:
+                result.append(bool(value & (1 << bit_index)))
+                count -= 1
+                bit_index += 1
+            bit_index = 0
         return result
 
+    def run_actions(self, start, stop):
+        """Run actions of registers in range(start, stop).
+
+        :meta private:
+        """
+        cells = self.registers
+        for i in cells.actions_in(start, stop):
+            action = cells.actions[i]
+            if self.action_interval and action not in self.read_actions:
+                continue
+            kwargs = cells.action_kwargs.get(i) or {}
+            self.action_methods[action](cells, i, cells[i], **kwargs)
+
+    # --------------------------------------------
+    # Action engine
+    # --------------------------------------------
+
+    def tick(self) -> None:
+        """Run all actions once, batched per action.
+
+        Used instead of running the actions at each read, when
+        "action interval" is configured. Actions triggered by reads
+        (reset) are not run.
+        """
+        cells = self.registers
+        if self._tick_version != cells.action_version:
+            batches: dict[int, list[int]] = {}
+            for inx in cells.action_list:
+                if (action := cells.actions[inx]) not in self.read_actions:
+                    batches.setdefault(action, []).append(inx)
+            self._tick_batches = list(batches.items())
+            self._tick_version = cells.action_version
+        for action, inxs in self._tick_batches:
+            if batch := self.action_batches[action]:
+                batch(cells, inxs)
+                continue
+            method = self.action_methods[action]
+            for inx in inxs:
+                method(cells, inx, cells[inx], **(cells.action_kwargs.get(inx) or {}))
+
+    def start_actions(self) -> asyncio.Task:
+        """Start running tick() every action interval (call from the event loop).
+
+        Ticks are scheduled at fixed times (start + n * interval), a tick
+        delayed by more than an interval skips the missed ticks.
+        """
+        if not self.action_interval:
+            raise RuntimeError(f'"{Label.action_interval}" not configured')
+        if not self._action_task:
+            self._action_task = asyncio.create_task(self._run_actions())
+            self._action_task.set_name("simulator actions")
+        return self._action_task
+
+    def stop_actions(self) -> None:
+        """Stop running tick()."""
+        if self._action_task:
+            self._action_task.cancel()
+            self._action_task = None
+
+    async def _run_actions(self) -> None:
+        """Run tick() every action interval."""
+        loop = asyncio.get_running_loop()
+        interval = self.action_interval
+        next_tick = loop.time()
+        while True:
+            try:
+                self.tick()
+            except Exception as exc:  # pylint: disable=broad-except
+                Log.error("Simulator action tick failed: {}", exc)
+            next_tick += interval
+            if (now := loop.time()) > next_tick:
+                next_tick += ((now - next_tick) // interval + 1) * interval
+            await asyncio.sleep(next_tick - now)
+
     def setValues(self, func_code, address, values):
         """Set the requested values of the datastore.
 
         :meta private:
         """
+        cells = self.registers
+        count_write = cells.count_write
         if func_code not in self._bits_func_code:
             real_address = self.fc_offset[func_code] + address
-            for value in values:
-                self.registers[real_address].value = value
-                self.registers[real_address].count_write += 1
-                real_address += 1
+            end_address = real_address + len(values)
+            cells.values[real_address:end_address] = array("H", values)
+            count_write.add(real_address, end_address)
             return
 
         # bit access
         real_address = self.fc_offset[func_code] + int(address / 16)
         bit_index = address % 16
+        cell_values = cells.values
         for value in values:
-            bit_mask = 2**bit_index
+            bit_mask = 1 << bit_index
             if bool(value):
-                self.registers[real_address].value |= bit_mask
+                cell_values[real_address] |= bit_mask
             else:
-                self.registers[real_address].value &= ~bit_mask
-            self.registers[real_address].count_write += 1
+                cell_values[real_address] &= ~bit_mask
+            count_write.add(real_address, real_address + 1)
             bit_index += 1
             if bit_index == 16:
                 bit_index = 0
@@ -748,6 +1064,75 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
             registers[inx].value = regs[0]
             registers[inx + 1].value = regs[1]
 
+    @classmethod
+    def batch_increment(cls, cells, inxs):
+        """Run action_increment on a list of cells.
+
+        :meta private:
+        """
+        values, types, kwargs = cells.values, cells.types, cells.action_kwargs
+        for inx in inxs:
+            if inx in kwargs or types[inx] not in (CellType.BITS, CellType.UINT16):
+                cls.action_increment(cells, inx, cells[inx], **kwargs.get(inx, {}))
+            else:
+                values[inx] = (values[inx] + 1) & 0xFFFF
+
+    @classmethod
+    def batch_random(cls, cells, inxs):
+        """Run action_random on a list of cells.
+
+        :meta private:
+        """
+        values, types, kwargs = cells.values, cells.types, cells.action_kwargs
+        randint = random.randint
+        for inx in inxs:
+            if inx in kwargs or types[inx] not in (CellType.BITS, CellType.UINT16):
+                cls.action_random(cells, inx, cells[inx], **kwargs.get(inx, {}))
+            else:
+                values[inx] = randint(1, 65536) & 0xFFFF
+
+    @classmethod
+    def batch_timestamp(cls, cells, inxs):
+        """Run action_timestamp on a list of cells.
+
+        :meta private:
+        """
+        system_time = datetime.now()
+        stamp = array(
+            "H",
+            (
+                system_time.year,
+                system_time.month - 1,
+                system_time.day,
+                system_time.weekday() + 1,
+                system_time.hour,
+                system_time.minute,
+                system_time.second,
+            ),
+        )
+        values = cells.values
+        for inx in inxs:
+            if inx + 7 <= len(values):
+                values[inx : inx + 7] = stamp
+
+    @classmethod
+    def batch_uptime(cls, cells, inxs):
+        """Run action_uptime on a list of cells.
+
+        :meta private:
+        """
+        value = int(datetime.now().timestamp()) - cls.start_time + 1
+        regs = {
+            CellType.BITS: [value & 0xFFFF],
+            CellType.UINT16: [value & 0xFFFF],
+            CellType.UINT32: cls.build_registers_from_value(value, True),
+            CellType.FLOAT32: cls.build_registers_from_value(value, False),
+        }
+        values, types = cells.values, cells.types
+        for inx in inxs:
+            if (new := regs.get(types[inx])) is not None and inx + len(new) <= len(values):
+                values[inx : inx + len(new)] = array("H", new)
+
     # --------------------------------------------
     # Internal helper methods
     # --------------------------------------------
@@ -770,10 +1155,11 @@ class ModbusSimulatorContext(ModbusBaseSlaveContext):
             check = (CellType.UINT32, CellType.FLOAT32, CellType.STRING)
             reg_step = 2
 
+        types = self.registers.types
         for i in range(real_address, real_address + count, reg_step):
-            if self.registers[i].type in check:
+            if types[i] in check:
                 continue
-            if self.registers[i].type is CellType.NEXT:
+            if types[i] == CellType.NEXT:
                 continue
             return False
         return True
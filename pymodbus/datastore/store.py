@@ -48,7 +48,9 @@ based on their preference.
 from __future__ import annotations
 
 from abc import ABC, abstractmethod
-from collections.abc import Iterable
+from array import array
+from bisect import bisect_right
+from collections.abc import Iterable, Mapping, MutableMapping
 from typing import Any, Generic, TypeVar
 
 from pymodbus.exceptions import ParameterException
@@ -58,7 +60,7 @@ from pymodbus.exceptions import ParameterException
 #  Datablock Storage
 # ---------------------------------------------------------------------------#
 
-V = TypeVar('V', list, dict[int, Any])
+V = TypeVar('V', list, dict[int, Any], array)
 class BaseModbusDataBlock(ABC, Generic[V]):
     """Base class for a modbus datastore.
 
@@ -140,7 +142,7 @@ class BaseModbusDataBlock(ABC, Generic[V]):
 
         :returns: An iterator of the data block data
         """
-        if isinstance(self.values, dict):
+        if isinstance(self.values, Mapping):
             return iter(self.values.items())
         return enumerate(self.values, self.address)
 
@@ -218,6 +220,219 @@ class ModbusSequentialDataBlock(BaseModbusDataBlock[list]):
         self.values[start : start + len(values)] = values
 
 
+class ModbusArrayDataBlock(BaseModbusDataBlock[array]):
+    """Creates a sequential modbus datastore, backed by a typed array.
+
+    Same contract as ModbusSequentialDataBlock, but the values are kept in
+    a stdlib array("H") (2 bytes/value, instead of a python object
+    per value), or optionally a numpy array.
+
+    getValues() returns a copy as array (or numpy array) made with one
+    memory copy, so responses keep the values read even when cached or
+    sent later, and setValues() accepts lists as well as
+    array/memoryview/numpy vectors, allowing the application to
+    update large blocks in one operation::
+
+        block = ModbusArrayDataBlock.create()
+        block.setValues(100, array("H", measurements))
+
+    .. tip:: use typecode="B" for coils/discrete inputs (1 byte/value).
+    """
+
+    def __init__(self, address, values, typecode="H", use_numpy=False):
+        """Initialize the datastore.
+
+        :param address: The starting address of the datastore
+        :param values: Either a list/array of values or a single value
+        :param typecode: array typecode, "H" (registers) or "B" (bits)
+        :param use_numpy: store the values in a numpy array (requires numpy)
+        """
+        if typecode not in ("H", "B"):
+            raise ParameterException(f"typecode {typecode} must be H or B")
+        self.address = address
+        self.typecode = typecode
+        self.use_numpy = use_numpy
+        if not hasattr(values, "__iter__"):
+            values = [values]
+        self.values = self._new_store(values)
+        self.default_value = 0
+
+    def _new_store(self, values):
+        """Create the storage array."""
+        if not self.use_numpy:
+            return array(self.typecode, values)
+        try:
+            import numpy  # pylint: disable=import-outside-toplevel
+        except ImportError as exc:
+            raise RuntimeError(
+                "use_numpy requires numpy "
+                'Please install with "pip install numpy" and try again.'
+            ) from exc
+        return numpy.array(values, dtype=self.typecode)
+
+    @classmethod
+    def create(cls, typecode="H", use_numpy=False):
+        """Create a datastore.
+
+        With the full address space initialized to 0x00
+
+        :returns: An initialized datastore
+        """
+        return cls(
+            0x00, array(typecode, [0]) * 65536, typecode=typecode, use_numpy=use_numpy
+        )
+
+    def default(self, count, value=False):
+        """Use to initialize a store to one value.
+
+        :param count: The number of fields to set
+        :param value: The default value to set to the fields
+        """
+        self.default_value = int(value)
+        self.values = self._new_store(array(self.typecode, [self.default_value]) * count)
+        self.address = 0x00
+
+    def reset(self):
+        """Reset the datastore to the initialized default value."""
+        self.values[:] = self._new_store(
+            array(self.typecode, [self.default_value]) * len(self.values)
+        )
+
+    def validate(self, address, count=1):
+        """Check to see if the request is in range.
+
+        :param address: The starting address
+        :param count: The number of values to test for
+        :returns: True if the request in within range, False otherwise
+        """
+        result = self.address <= address
+        result &= (self.address + len(self.values)) >= (address + count)
+        return result
+
+    def getValues(self, address, count=1):
+        """Return the requested values of the datastore.
+
+        :param address: The starting address
+        :param count: The number of values to retrieve
+        :returns: A copy (array) of the requested values from a:a+c
+        """
+        start = address - self.address
+        if self.use_numpy:
+            return self.values[start : start + count].copy()
+        # slicing an array copies the items once (memcpy) into a new array.
+        return self.values[start : start + count]
+
+    def setValues(self, address, values):
+        """Set the requested values of the datastore.
+
+        :param address: The starting address
+        :param values: The new values to be set (list, array, memoryview or numpy array)
+        """
+        if not hasattr(values, "__len__"):
+            values = [values]
+        start = address - self.address
+        if not self.use_numpy and not (
+            isinstance(values, array) and values.typecode == self.typecode
+        ):
+            values = array(self.typecode, values)
+        self.values[start : start + len(values)] = values
+
+
+class ModbusSharedMemoryDataBlock(ModbusArrayDataBlock):
+    """Array datastore placed in an external (shared memory) buffer.
+
+    The values are a memoryview over the buffer, so every process
+    mapping the same multiprocessing.shared_memory segment sees the
+    same values (see ModbusSharedServerContext).
+
+    .. warning:: there are no locks, a multi register write might be
+        seen partially by a concurrent read in another process.
+    """
+
+    def __init__(self, address, buffer, typecode="H"):  # pylint: disable=super-init-not-called
+        """Initialize the datastore.
+
+        :param address: The starting address of the datastore
+        :param buffer: writable byte buffer (e.g. SharedMemory.buf slice)
+        :param typecode: array typecode, "H" (registers) or "B" (bits)
+        """
+        if typecode not in ("H", "B"):
+            raise ParameterException(f"typecode {typecode} must be H or B")
+        self.address = address
+        self.typecode = typecode
+        self.use_numpy = False
+        self.values = memoryview(buffer).cast(typecode)  # type: ignore[assignment]
+        self.default_value = 0
+
+    def default(self, count, value=False):
+        """Use to initialize a store to one value.
+
+        :param count: The number of fields to set (must be the buffer size)
+        :param value: The default value to set to the fields
+        :raises ParameterException:
+        """
+        if count != len(self.values):
+            raise ParameterException("shared memory datastore cannot be resized")
+        self.default_value = int(value)
+        self.reset()
+
+    def getValues(self, address, count=1):
+        """Return the requested values of the datastore.
+
+        :param address: The starting address
+        :param count: The number of values to retrieve
+        :returns: A copy (array) of the requested values from a:a+c
+        """
+        start = address - self.address
+        # a slice would be a view into (and pin) the shared memory.
+        values = array(self.typecode)
+        with self.values[start : start + count] as view:
+            values.frombytes(view.cast("B"))
+        return values
+
+
+class SparseValues(MutableMapping):
+    """{address: value} view of a ModbusSparseDataBlock.
+
+    Reads and writes go to the datablock runs, so
+    :code:`block.values[address] = value` works as with a dict.
+    """
+
+    def __init__(self, block: ModbusSparseDataBlock):
+        """Initialize view.
+
+        :param block: the datablock
+        """
+        self.block = block
+
+    def __getitem__(self, address):
+        """Return value at address."""
+        if (inx := self.block._find_run(address)) < 0:  # pylint: disable=protected-access
+            raise KeyError(address)
+        return self.block._runs[inx][address - self.block._starts[inx]]  # pylint: disable=protected-access
+
+    def __setitem__(self, address, value):
+        """Set value at address (adding it if new)."""
+        self.block._set_run(address, [value])  # pylint: disable=protected-access
+
+    def __delitem__(self, address):
+        """Remove address (splitting its run)."""
+        self.block._del_address(address)  # pylint: disable=protected-access
+
+    def __iter__(self):
+        """Iterate over addresses, ascending."""
+        for start, run in zip(self.block._starts, self.block._runs):  # pylint: disable=protected-access
+            yield from range(start, start + len(run))
+
+    def __len__(self):
+        """Return number of addresses."""
+        return sum(len(run) for run in self.block._runs)  # pylint: disable=protected-access
+
+    def __repr__(self):
+        """Return dict representation."""
+        return repr(dict(self.items()))
+
+
 class ModbusSparseDataBlock(BaseModbusDataBlock[dict[int, Any]]):
     """A sparse modbus datastore.
 
@@ -253,11 +468,25 @@ class ModbusSparseDataBlock(BaseModbusDataBlock[dict[int, Any]]):
         For each list, a sparse datablock is created, starting at 'offset' with the length of the list
         For each integer, the value is set for the corresponding offset.
 
+        The values are kept as sorted runs of contiguous addresses
+        (_starts[i] is the address of _runs[i][0]), adjacent runs are merged,
+        so a valid request always lies within one run.
         """
-        self.values = {}
+        self._starts: list[int] = []
+        self._runs: list[list] = []
         self._process_values(values)
         self.mutable = mutable
-        self.default_value = self.values.copy()
+        self.default_value = dict(self.values)
+
+    @property
+    def values(self) -> SparseValues:  # type: ignore[override]
+        """Return a {address: value} view of the datastore (writes go to the datastore)."""
+        return SparseValues(self)
+
+    @values.setter
+    def values(self, values: Mapping[int, Any]):
+        """Replace the datastore content with {address: value}."""
+        self._build_runs(dict(values))
 
     @classmethod
     def create(cls, values=None):
@@ -272,7 +501,70 @@ class ModbusSparseDataBlock(BaseModbusDataBlock[dict[int, Any]]):
 
     def reset(self):
         """Reset the store to the initially provided defaults."""
-        self.values = self.default_value.copy()
+        self.values = self.default_value
+
+    def _find_run(self, address):
+        """Return index of the run containing address, or -1."""
+        inx = bisect_right(self._starts, address) - 1
+        if inx >= 0 and address < self._starts[inx] + len(self._runs[inx]):
+            return inx
+        return -1
+
+    def _del_address(self, address):
+        """Remove address, splitting its run."""
+        if (inx := self._find_run(address)) < 0:
+            raise KeyError(address)
+        start, run = self._starts[inx], self._runs[inx]
+        offset = address - start
+        parts = [
+            (part_start, part)
+            for part_start, part in ((start, run[:offset]), (address + 1, run[offset + 1 :]))
+            if part
+        ]
+        self._starts[inx : inx + 1] = [part_start for part_start, _ in parts]
+        self._runs[inx : inx + 1] = [part for _, part in parts]
+
+    def _build_runs(self, values: dict):
+        """Replace the runs with {address: value} in one sorted pass."""
+        self._starts = []
+        self._runs = []
+        run_end = None
+        for address in sorted(values):
+            if address != run_end:
+                self._starts.append(address)
+                self._runs.append([])
+            self._runs[-1].append(values[address])
+            run_end = address + 1
+
+    def _set_run(self, address, values):
+        """Store values at address, merging with overlapping/adjacent runs.
+
+        The first touched run is extended in place, so appending to or
+        prepending to a run only costs the length of values.
+        """
+        if not (count := len(values)):
+            return
+        end = address + count
+        first = bisect_right(self._starts, address) - 1
+        if first < 0 or self._starts[first] + len(self._runs[first]) < address:
+            first += 1
+        last = bisect_right(self._starts, end) - 1
+        if first > last:
+            self._starts.insert(first, address)
+            self._runs.insert(first, list(values))
+            return
+        run = self._runs[first]
+        if (start := self._starts[first]) > address:
+            run[:0] = values[: start - address]
+            self._starts[first] = start = address
+        offset = address - start
+        run[offset : offset + count] = values
+        if last > first:
+            last_start, last_run = self._starts[last], self._runs[last]
+            if last_start + len(last_run) > end:
+                run.extend(last_run[end - last_start :])
+            del self._starts[first + 1 : last + 1]
+            del self._runs[first + 1 : last + 1]
 
     def validate(self, address, count=1):
         """Check to see if the request is in range.
@@ -283,8 +575,10 @@ class ModbusSparseDataBlock(BaseModbusDataBlock[dict[int, Any]]):
         """
         if not count:
             return False
-        handle = set(range(address, address + count))
-        return handle.issubset(set(iter(self.values.keys())))
+        inx = self._find_run(address)
+        return inx >= 0 and address + count <= self._starts[inx] + len(
+            self._runs[inx]
+        )
 
     def getValues(self, address, count=1):
         """Return the requested values of the datastore.
@@ -292,8 +586,15 @@ class ModbusSparseDataBlock(BaseModbusDataBlock[dict[int, Any]]):
         :param address: The starting address
         :param count: The number of values to retrieve
         :returns: The requested values from a:a+c
+        :raises KeyError: if the range is not (completely) in the datastore
         """
-        return [self.values[i] for i in range(address, address + count)]
+        if not count:
+            return []
+        if not self.validate(address, count):
+            raise KeyError(address)
+        inx = self._find_run(address)
+        offset = address - self._starts[inx]
+        return self._runs[inx][offset : offset + count]
 
     def _process_values(self, values):
         """Process values."""
@@ -301,23 +602,29 @@ class ModbusSparseDataBlock(BaseModbusDataBlock[dict[int, Any]]):
         def _process_as_dict(values):
             for idx, val in iter(values.items()):
                 if isinstance(val, (list, tuple)):
-                    for i, v_item in enumerate(val):
-                        self.values[idx + i] = v_item
+                    self._set_run(idx, list(val))
                 else:
-                    self.values[idx] = int(val)
+                    self._set_run(idx, [int(val)])
 
-        if isinstance(values, dict):
-            _process_as_dict(values)
+        if isinstance(values, Mapping):
+            if self._runs:
+                _process_as_dict(values)
+                return
+            flat: dict[int, Any] = {}
+            for idx, val in iter(values.items()):
+                if isinstance(val, (list, tuple)):
+                    flat.update(zip(range(idx, idx + len(val)), val))
+                else:
+                    flat[idx] = int(val)
+            self._build_runs(flat)
             return
         if hasattr(values, "__iter__"):
-            values = dict(enumerate(values))
-        elif values is None:
-            values = {}  # Must make a new dict here per instance
-        else:
+            self._set_run(0, list(values))
+            return
+        if values is not None:
             raise ParameterException(
                 "Values for datastore must be a list or dictionary"
             )
-        _process_as_dict(values)
 
     def setValues(self, address, values, use_as_default=False):
         """Set the requested values of the datastore.
@@ -327,18 +634,16 @@ class ModbusSparseDataBlock(BaseModbusDataBlock[dict[int, Any]]):
         :param use_as_default: Use the values as default
         :raises ParameterException:
         """
-        if isinstance(values, dict):
-            new_offsets = list(set(values.keys()) - set(self.values.keys()))
+        if isinstance(values, Mapping):
+            new_offsets = [key for key in values if self._find_run(key) < 0]
             if new_offsets and not self.mutable:
                 raise ParameterException(f"Offsets {new_offsets} not in range")
             self._process_values(values)
         else:
             if not isinstance(values, list):
                 values = [values]
-            for idx, val in enumerate(values):
-                if address + idx not in self.values and not self.mutable:
-                    raise ParameterException("Offset {address+idx} not in range")
-                self.values[address + idx] = val
+            if not self.mutable and values and not self.validate(address, len(values)):
+                raise ParameterException(f"Offset {address} not in range")
+            self._set_run(address, values)
         if use_as_default:
-            for idx, val in iter(self.values.items()):
-                self.default_value[idx] = val
+            self.default_value.update(self.values)
@@ -16,7 +16,7 @@ __all__ = [
 import struct
 
 # pylint: disable=missing-type-doc
-from collections import OrderedDict
+from collections import OrderedDict, deque
 
 from pymodbus.constants import INTERNAL_ERROR, DeviceInformation
 from pymodbus.events import ModbusEvent
@@ -451,7 +451,7 @@ class ModbusControlBlock:
     __counters = ModbusCountersHandler()
     __identity = ModbusDeviceIdentification()
     __plus = ModbusPlusStatistics()
-    __events: list[ModbusEvent] = []
+    __events: deque[ModbusEvent] = deque(maxlen=64)
 
     # -------------------------------------------------------------------------#
     #  Magic
@@ -484,8 +484,7 @@ class ModbusControlBlock:
 
         :param event: A new event to add to the log
         """
-        self.__events.insert(0, event)
-        self.__events = self.__events[0:64]  # chomp to 64 entries
+        self.__events.appendleft(event)  # newest first, keeps 64 entries
         self.Counter.Event += 1
 
     def getEvents(self):
@@ -498,19 +497,19 @@ class ModbusControlBlock:
 
     def clearEvents(self):
         """Clear the current list of events."""
-        self.__events = []
+        self.__events.clear()
 
     # -------------------------------------------------------------------------#
     #  Other Properties
     # -------------------------------------------------------------------------#
     Identity = property(lambda s: s.__identity)
     Counter = property(lambda s: s.__counters)
-    Events = property(lambda s: s.__events)
+    Events = property(lambda s: list(s.__events))
     Plus = property(lambda s: s.__plus)
 
     def reset(self):
         """Clear all of the system counters and the diagnostic register."""
-        self.__events = []
+        self.__events.clear()
         self.__counters.reset()
         self.__diagnostic = [False] * 16
 
@@ -6,7 +6,8 @@ add them to the respective function lookup table (order doesn't matter, but
 it does help keep things organized).
 
 Regardless of how many functions are added to the lookup, O(1) behavior is
-kept as a result of a pre-computed lookup dictionary.
+kept as a result of a pre-computed lookup dictionary, which is flattened
+into a 256 entry table (indexed by function code) used when decoding.
 """
 
 # pylint: disable=missing-type-doc
@@ -25,6 +26,61 @@ from pymodbus.pdu import register_read_message as reg_r_msg
 from pymodbus.pdu import register_write_message as reg_w_msg
 
 
+#: Functions where the sub function code is known before decode, and
+#: how to get it from the raw pdu (function code at data[0]).
+SUB_FUNCTION_CODE = {
+    diag_msg.DiagnosticStatusRequest.function_code: lambda data: int.from_bytes(data[1:3], "big"),
+    mei_msg.ReadDeviceInformationRequest.function_code: lambda data: data[1],
+}
+
+
+def build_decode_table(lookup, sub_lookup):
+    """Build flat decode table.
+
+    :param lookup: {function_code: class}
+    :param sub_lookup: {function_code: {sub_function_code: class}}
+    :returns: 256 entries, each None, a class or (class, sub lookup, get sub code)
+
+    The tuple form is used for functions with sub functions, get sub code is
+    None if the sub function code can only be found by decoding.
+    """
+    table: list = [None] * 256
+    for function_code, function in lookup.items():
+        if 0 <= function_code <= 255:
+            if sub := sub_lookup.get(function_code):
+                table[function_code] = (function, sub, SUB_FUNCTION_CODE.get(function_code))
+            else:
+                table[function_code] = function
+    return table
+
+
+def decode_from_table(table, data, create=None):
+    """Create and decode pdu object using the flat decode table.
+
+    :param table: table from build_decode_table()
+    :param data: raw pdu, starting with the function code
+    :param create: called with the class to get the pdu object, default class()
+    :returns: decoded object or None if function code is unknown
+    """
+    if not (entry := table[data[0]]):
+        return None
+    if entry.__class__ is not tuple:
+        pdu_obj = create(entry) if create else entry()
+        pdu_obj.decode(data[1:])
+        return pdu_obj
+    function, sub_lookup, get_sub_code = entry
+    if get_sub_code and len(data) > 2:
+        function = sub_lookup.get(get_sub_code(data), function)
+        pdu_obj = create(function) if create else function()
+        pdu_obj.decode(data[1:])
+        return pdu_obj
+    pdu_obj = create(function) if create else function()
+    pdu_obj.decode(data[1:])
+    if subtype := sub_lookup.get(getattr(pdu_obj, "sub_function_code", None)):
+        pdu_obj.__class__ = subtype
+    return pdu_obj
+
+
 # --------------------------------------------------------------------------- #
 # Server Decoder
 # --------------------------------------------------------------------------- #
@@ -88,6 +144,7 @@ class ServerDecoder:
         self.__sub_lookup: dict[int, dict[int, Callable]] = {f: {} for f in functions}
         for f in self.__sub_function_table:
             self.__sub_lookup[f.function_code][f.sub_function_code] = f  # type: ignore[attr-defined]
+        self._table = build_decode_table(self.lookup, self.__sub_lookup)
 
     def decode(self, message):
         """Decode a request packet.
@@ -117,25 +174,14 @@ class ServerDecoder:
         :param data: The request packet to decode
         :returns: The decoded request or illegal function request object
         """
-        function_code = int(data[0])
-        if not (request := self.lookup.get(function_code, lambda: None)()):
-            Log.debug("Factory Request[{}]", function_code)
+        if not (request := decode_from_table(self._table, data)):
+            function_code = int(data[0])
+            if Log.hot_path:
+                Log.debug("Factory Request[{}]", function_code)
             request = pdu.IllegalFunctionRequest(function_code)
-        else:
-            fc_string = "{}: {}".format(  # pylint: disable=consider-using-f-string
-                str(self.lookup[function_code])  # pylint: disable=use-maxsplit-arg
-                .split(".")[-1]
-                .rstrip('">"'),
-                function_code,
-            )
-            Log.debug("Factory Request[{}]", fc_string)
-        request.decode(data[1:])
-
-        if hasattr(request, "sub_function_code"):
-            lookup = self.__sub_lookup.get(request.function_code, {})
-            if subtype := lookup.get(request.sub_function_code, None):
-                request.__class__ = subtype
-
+            request.decode(data[1:])
+        elif Log.hot_path:
+            Log.debug("Factory Request[{}: {}]", request.__class__.__name__, data[0])
         return request
 
     def register(self, function):
@@ -157,6 +203,68 @@ class ServerDecoder:
             self.__sub_lookup[function.function_code][
                 function.sub_function_code
             ] = function
+        self._table = build_decode_table(self.lookup, self.__sub_lookup)
+
+
+class ModbusRequestPool:
+    """Per connection pool of request objects (Server).
+
+    Wraps a ServerDecoder, decode() reuses the request objects given back
+    with release() instead of allocating new ones. The server releases a
+    request when the response is sent, so a request_tracer must not keep
+    a reference to the request.
+
+    Only requests with :code:`decode_sets_all = True` are reused, they only
+    need the header fields reset, calling __init__() again is slower than
+    allocating a new object.
+    """
+
+    def __init__(self, decoder: ServerDecoder, size: int = 8) -> None:
+        """Initialize pool.
+
+        :param decoder: ServerDecoder to decode with
+        :param size: max. number of free objects kept per request class
+        """
+        self.decoder = decoder
+        self.lookup = decoder.lookup
+        self.size = size
+        self.free: dict[type, list] = {}
+
+    def decode(self, message):
+        """Decode a request packet, reusing a free request object.
+
+        :param message: The raw modbus request packet
+        :return: The decoded modbus message or None if error
+        """
+        try:
+            table = self.decoder._table  # pylint: disable=protected-access
+            if request := decode_from_table(table, message, self._acquire):
+                if Log.hot_path:
+                    Log.debug("Factory Request[{}: {}]", request.__class__.__name__, message[0])
+                return request
+        except ModbusException:
+            pass
+        # unknown function code or decode error, handled (and logged) by the decoder.
+        return self.decoder.decode(message)
+
+    def _acquire(self, function):
+        """Return a free object of class function, or a new object."""
+        if free := self.free.get(function):
+            request = free.pop()
+            request.transaction_id = request.protocol_id = 0
+            request.slave_id = request.check = 0
+            request.skip_encode = False
+            return request
+        return function()
+
+    def release(self, request) -> None:
+        """Give request back to the pool, it must not be used afterwards."""
+        if not request.decode_sets_all:
+            return
+        if (free := self.free.get(request.__class__)) is None:
+            free = self.free[request.__class__] = []
+        if len(free) < self.size:
+            free.append(request)
 
 
 # --------------------------------------------------------------------------- #
@@ -217,6 +325,7 @@ class ClientDecoder:
         self.__sub_lookup: dict[int, dict[int, Callable]] = {f: {} for f in functions}
         for f in self.__sub_function_table:
             self.__sub_lookup[f.function_code][f.sub_function_code] = f  # type: ignore[attr-defined]
+        self._table = build_decode_table(self.lookup, self.__sub_lookup)
 
     def lookupPduClass(self, function_code):
         """Use `function_code` to determine the class of the PDU.
@@ -249,29 +358,17 @@ class ClientDecoder:
         :returns: The decoded request or an exception response object
         :raises ModbusException:
         """
-        fc_string = data[0]
-        function_code = int(fc_string)
-        if function_code in self.lookup:  # pylint: disable=consider-using-assignment-expr
-            fc_string = "{}: {}".format(  # pylint: disable=consider-using-f-string
-                str(self.lookup[function_code])  # pylint: disable=use-maxsplit-arg
-                .split(".")[-1]
-                .rstrip('">"'),
-                function_code,
-            )
-        Log.debug("Factory Response[{}]", fc_string)
-        response = self.lookup.get(function_code, lambda: None)()
+        function_code = int(data[0])
         if function_code > 0x80:
             code = function_code & 0x7F  # strip error portion
             response = pdu.ExceptionResponse(code, pdu.ModbusExceptions.IllegalFunction)
-        if not response:
+            response.decode(data[1:])
+        elif not (response := decode_from_table(self._table, data)):
+            if Log.hot_path:
+                Log.debug("Factory Response[{}]", function_code)
             raise ModbusException(f"Unknown response {function_code}")
-        response.decode(data[1:])
-
-        if hasattr(response, "sub_function_code"):
-            lookup = self.__sub_lookup.get(response.function_code, {})
-            if subtype := lookup.get(response.sub_function_code, None):
-                response.__class__ = subtype
-
+        if Log.hot_path:
+            Log.debug("Factory Response[{}: {}]", response.__class__.__name__, function_code)
         return response
 
     def register(self, function):
@@ -289,3 +386,4 @@ class ClientDecoder:
             self.__sub_lookup[function.function_code][
                 function.sub_function_code
             ] = function
+        self._table = build_decode_table(self.lookup, self.__sub_lookup)
@@ -30,20 +30,28 @@ class FramerAscii(FramerBase):
     START = b':'
     END = b'\r\n'
     MIN_SIZE = 10
+    MAX_SIZE = 1 + 2 + 2 * 253 + 2 + 2
 
 
     def decode(self, data: bytes) -> tuple[int, int, int, bytes]:
         """Decode ADU."""
-        if (used_len := len(data)) < self.MIN_SIZE:
-            Log.debug("Short frame: {} wait for more data", data, ":hex")
+        if len(data) < self.MIN_SIZE:
+            if Log.hot_path:
+                Log.debug("Short frame: {} wait for more data", data, ":hex")
             return 0, 0, 0, self.EMPTY
+        data = bytes(data[: self.MAX_SIZE])
+        used_len = len(data)
         if data[0:1] != self.START:
             if (start := data.find(self.START)) != -1:
                 used_len = start
             Log.debug("Garble data before frame: {}, skip until start of frame", data, ":hex")
             return used_len, 0, 0, self.EMPTY
         if (used_len := data.find(self.END)) == -1:
-            Log.debug("Incomplete frame: {} wait for more data", data, ":hex")
+            if len(data) == self.MAX_SIZE:
+                Log.debug("No end of frame within max frame size: {}, skip start", data, ":hex")
+                return 1, 0, 0, self.EMPTY
+            if Log.hot_path:
+                Log.debug("Incomplete frame: {} wait for more data", data, ":hex")
             return 0, 0, 0, self.EMPTY
 
         dev_id = int(data[1:3], 16)
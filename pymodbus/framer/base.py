@@ -11,6 +11,7 @@ class FramerBase:
     """Intern base."""
 
     EMPTY = b''
+    crc_errors = 0  # frames dropped due to a checksum error
 
     def __init__(self) -> None:
         """Initialize a ADU instance."""
@@ -18,6 +19,9 @@ class FramerBase:
     def decode(self, data: bytes) -> tuple[int, int, int, bytes]:
         """Decode ADU.
 
+        data can be bytes or a memoryview (slice of the receive buffer),
+        the returned request/response can be a memoryview as well.
+
         returns:
             used_len (int) or 0 to read more
             transaction_id (int) or 0
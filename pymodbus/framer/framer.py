@@ -81,13 +81,18 @@ class Framer(ModbusProtocol):
 
 
     def callback_data(self, data: bytes, addr: tuple | None = None) -> int:
-        """Handle received data."""
+        """Handle received data.
+
+        Frames are decoded from a memoryview, so only the frames
+        themselves are copied, not the remaining data.
+        """
         tot_len = len(data)
         start = 0
+        view = memoryview(data)
         while True:
-            used_len, tid, device_id, msg = self.handle.decode(data[start:])
+            used_len, tid, device_id, msg = self.handle.decode(view[start:])
             if msg:
-                self.callback_request_response(msg, device_id, tid)
+                self.callback_request_response(bytes(msg), device_id, tid)
             if not used_len:
                 return start
             start += used_len
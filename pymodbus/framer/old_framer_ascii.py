@@ -50,12 +50,14 @@ class ModbusAsciiFramer(ModbusFramer):
 
     def frameProcessIncomingPacket(self, single, callback, slave, _tid=None, **kwargs):
         """Process new packet pattern."""
-        while len(self._buffer):
-            used_len, _tid, dev_id, data = self.message_handler.decode(self._buffer)
+        used = 0
+        view = memoryview(self._buffer)
+        while used < len(self._buffer):
+            used_len, _tid, dev_id, data = self.message_handler.decode(view[used:])
             if not data:
                 if not used_len:
-                    return
-                self._buffer = self._buffer[used_len :]
+                    break
+                used += used_len
                 continue
             self._header["uid"] = dev_id
             if not self._validate_slave_id(slave, single):
@@ -64,8 +66,10 @@ class ModbusAsciiFramer(ModbusFramer):
                 return
 
             if (result := self.decoder.decode(data)) is None:
+                self._buffer = self._buffer[used:]
                 raise ModbusIOException("Unable to decode response")
             self.populateResult(result)
-            self._buffer = self._buffer[used_len :]
+            used += used_len
             self._header = {"uid": 0x00}
             callback(result)  # defer this
+        self._buffer = self._buffer[used:]
@@ -92,9 +92,10 @@ class ModbusFramer:
         end of the message (python just doesn't have the resolution to
         check for millisecond delays).
         """
-        Log.debug(
-            "Resetting frame - Current Frame in buffer - {}", self._buffer, ":hex"
-        )
+        if Log.hot_path:
+            Log.debug(
+                "Resetting frame - Current Frame in buffer - {}", self._buffer, ":hex"
+            )
         self._buffer = b""
         self._header = {
             "lrc": "0000",
@@ -136,7 +137,8 @@ class ModbusFramer:
         :param kwargs:
         :raises ModbusIOException:
         """
-        Log.debug("Processing: {}", data, ":hex")
+        if Log.hot_path:
+            Log.debug("Processing: {}", data, ":hex")
         self._buffer += data
         if self._buffer == b'':
             return
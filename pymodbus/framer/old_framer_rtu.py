@@ -1,9 +1,8 @@
 """RTU framer."""
 # pylint: disable=missing-type-doc
-import struct
 import time
 
-from pymodbus.exceptions import ModbusIOException
+from pymodbus.exceptions import ModbusIOException, NotImplementedException
 from pymodbus.framer.old_framer_base import BYTE_ORDER, FRAME_HEADER, ModbusFramer
 from pymodbus.framer.rtu import FramerRTU
 from pymodbus.logging import Log
@@ -13,6 +12,34 @@ from pymodbus.utilities import ModbusTransactionState
 RTU_FRAME_HEADER = BYTE_ORDER + FRAME_HEADER
 
 
+class DecoderFramerRTU(FramerRTU):
+    """FramerRTU, with frame sizes from the decoder pdu classes."""
+
+    def __init__(self, decoder):
+        """Initialize frame hunter.
+
+        :param decoder: The decoder factory implementation to use
+        """
+        super().__init__()
+        self.decoder = decoder
+
+    def frame_size(self, data):
+        """Return size of the frame starting at data[0].
+
+        Custom pdu classes registered in the decoder are picked up.
+        """
+        lookup = self.decoder.lookup if self.decoder else {}
+        if (pdu_class := lookup.get(data[1])) is None:
+            return 5 if (data[1] - 0x80) in lookup else -1
+        try:
+            size = pdu_class.calculateRtuFrameSize(data)
+        except IndexError:
+            return 0
+        except NotImplementedException:
+            return -1
+        return size if size <= self.MAX_SIZE else -1
+
+
 # --------------------------------------------------------------------------- #
 # Modbus RTU old Framer
 # --------------------------------------------------------------------------- #
@@ -59,7 +86,7 @@ class ModbusRtuFramer(ModbusFramer):
         super().__init__(decoder, client)
         self._hsize = 0x01
         self.function_codes = decoder.lookup.keys() if decoder else {}
-        self.message_handler = FramerRTU()
+        self.message_handler = DecoderFramerRTU(decoder)
 
     def decode_data(self, data):
         """Decode data."""
@@ -70,100 +97,57 @@ class ModbusRtuFramer(ModbusFramer):
         return {}
 
 
-    def frameProcessIncomingPacket(self, _single, callback, slave, _tid=None, **kwargs):  # noqa: C901
-        """Process new packet pattern."""
-
-        def is_frame_ready(self):
-            """Check if we should continue decode logic."""
-            size = self._header.get("len", 0)
-            if not size and len(self._buffer) > self._hsize:
-                try:
-                    self._header["uid"] = int(self._buffer[0])
-                    self._header["tid"] = int(self._buffer[0])
-                    self._header["tid"] = 0  # fix for now
-                    func_code = int(self._buffer[1])
-                    pdu_class = self.decoder.lookupPduClass(func_code)
-                    size = pdu_class.calculateRtuFrameSize(self._buffer)
-                    self._header["len"] = size
-
-                    if len(self._buffer) < size:
-                        raise IndexError
-                    self._header["crc"] = self._buffer[size - 2 : size]
-                except IndexError:
-                    return False
-            return len(self._buffer) >= size if size > 0 else False
-
-        def get_frame_start(self, slaves, broadcast, skip_cur_frame):
-            """Scan buffer for a relevant frame start."""
-            start = 1 if skip_cur_frame else 0
-            if (buf_len := len(self._buffer)) < 4:
-                return False
-            for i in range(start, buf_len - 3):  # <slave id><function code><crc 2 bytes>
-                if not broadcast and self._buffer[i] not in slaves:
-                    continue
-                if (
-                    self._buffer[i + 1] not in self.function_codes
-                    and (self._buffer[i + 1] - 0x80) not in self.function_codes
-                ):
-                    continue
-                if i:
-                    self._buffer = self._buffer[i:]  # remove preceding trash.
-                return True
-            if buf_len > 3:
-                self._buffer = self._buffer[-3:]
-            return False
-
-        def check_frame(self):
-            """Check if the next frame is available."""
-            try:
-                self._header["uid"] = int(self._buffer[0])
-                self._header["tid"] = int(self._buffer[0])
-                self._header["tid"] = 0  # fix for now
-                func_code = int(self._buffer[1])
-                pdu_class = self.decoder.lookupPduClass(func_code)
-                size = pdu_class.calculateRtuFrameSize(self._buffer)
-                self._header["len"] = size
-
-                if len(self._buffer) < size:
-                    raise IndexError
-                self._header["crc"] = self._buffer[size - 2 : size]
-                frame_size = self._header["len"]
-                data = self._buffer[: frame_size - 2]
-                crc = self._header["crc"]
-                crc_val = (int(crc[0]) << 8) + int(crc[1])
-                return FramerRTU.check_CRC(data, crc_val)
-            except (IndexError, KeyError, struct.error):
-                return False
-
-        broadcast = not slave[0]
-        skip_cur_frame = False
-        while get_frame_start(self, slave, broadcast, skip_cur_frame):
-            self._header = {"uid": 0x00, "len": 0, "crc": b"\x00\x00"}
-            if not is_frame_ready(self):
-                Log.debug("Frame - not ready")
-                break
-            if not check_frame(self):
-                Log.debug("Frame check failed, ignoring!!")
-                x = self._buffer
+    def frameProcessIncomingPacket(self, _single, callback, slave, _tid=None, **kwargs):
+        """Process new packet pattern.
+
+        Frames are found by the incremental frame hunter in message_handler,
+        bytes already rejected as frame start are not scanned again, and
+        the buffer is only sliced once per call.
+        """
+        hunter = self.message_handler
+        hunter.dev_ids = slave
+        hunter.broadcast = not slave[0]
+        crc_errors = hunter.crc_errors
+        results = []
+        used = 0
+        view = memoryview(self._buffer)
+        try:
+            while True:
+                start, end = hunter.hunt_frame(view[used:])
+                if not end:
+                    hunter.consume(start)
+                    used += start
+                    break
+                self._header = {
+                    "uid": view[used + start],
+                    "tid": 0,
+                    "len": end - start,
+                    "crc": bytes(view[used + end - 2 : used + end]),
+                }
+                data = bytes(view[used + start + self._hsize : used + end - 2])
+                hunter.consume(end)
+                used += end
+                if Log.hot_path:
+                    Log.debug("Getting Frame - {}", data, ":hex")
+                if (result := self.decoder.decode(data)) is None:
+                    raise ModbusIOException("Unable to decode request")
+                result.slave_id = self._header["uid"]
+                result.transaction_id = 0
+                results.append(result)
+        finally:
+            view.release()
+            self._buffer = self._buffer[used:]
+            if hunter.crc_errors != crc_errors and not hunter.pending:
+                buffer = self._buffer
                 self.resetFrame()
-                self._buffer = x
-                skip_cur_frame = True
-                continue
-            start = self._hsize
-            end = self._header["len"] - 2
-            buffer = self._buffer[start:end]
-            if end > 0:
-                Log.debug("Getting Frame - {}", buffer, ":hex")
-                data = buffer
-            else:
-                data = b""
-            if (result := self.decoder.decode(data)) is None:
-                raise ModbusIOException("Unable to decode request")
-            result.slave_id = self._header["uid"]
-            result.transaction_id = 0
-            self._buffer = self._buffer[self._header["len"] :]
-            Log.debug("Frame advanced, resetting header!!")
-            callback(result)  # defer or push to a thread?
+                self._buffer = buffer
+            for result in results:
+                callback(result)  # defer or push to a thread?
+
+    def resetFrame(self):
+        """Reset the entire message frame."""
+        super().resetFrame()
+        self.message_handler.reset()
 
     def buildPacket(self, message):
         """Create a ready to send modbus packet.
@@ -191,18 +175,20 @@ class ModbusRtuFramer(ModbusFramer):
         while self.client.state != ModbusTransactionState.IDLE:
             if self.client.state == ModbusTransactionState.TRANSACTION_COMPLETE:
                 timestamp = round(time.time(), 6)
-                Log.debug(
-                    "Changing state to IDLE - Last Frame End - {} Current Time stamp - {}",
-                    self.client.last_frame_end,
-                    timestamp,
-                )
+                if Log.hot_path:
+                    Log.debug(
+                        "Changing state to IDLE - Last Frame End - {} Current Time stamp - {}",
+                        self.client.last_frame_end,
+                        timestamp,
+                    )
                 if self.client.last_frame_end:
                     idle_time = self.client.idle_time()
                     if round(timestamp - idle_time, 6) <= self.client.silent_interval:
-                        Log.debug(
-                            "Waiting for 3.5 char before next send - {} ms",
-                            self.client.silent_interval * 1000,
-                        )
+                        if Log.hot_path:
+                            Log.debug(
+                                "Waiting for 3.5 char before next send - {} ms",
+                                self.client.silent_interval * 1000,
+                            )
                         time.sleep(self.client.silent_interval)
                 else:
                     # Recovering from last error ??
@@ -220,7 +206,8 @@ class ModbusRtuFramer(ModbusFramer):
                 )
                 self.client.state = ModbusTransactionState.IDLE
             else:
-                Log.debug("Sleeping")
+                if Log.hot_path:
+                    Log.debug("Sleeping")
                 time.sleep(self.client.silent_interval)
         size = self.client.send(message)
         self.client.last_frame_end = round(time.time(), 6)
@@ -71,12 +71,12 @@ class ModbusSocketFramer(ModbusFramer):
         The processed and decoded messages are pushed to the callback
         function to process and send.
         """
-        while True:
-            if self._buffer == b'':
-                return
-            used_len, use_tid, dev_id, data = self.message_handler.decode(self._buffer)
+        used = 0
+        view = memoryview(self._buffer)
+        while used < len(self._buffer):
+            used_len, use_tid, dev_id, data = self.message_handler.decode(view[used:])
             if not data:
-                return
+                break
             self._header["uid"] = dev_id
             self._header["tid"] = use_tid
             self._header["pid"] = 0
@@ -84,13 +84,14 @@ class ModbusSocketFramer(ModbusFramer):
                 Log.debug("Not a valid slave id - {}, ignoring!!", dev_id)
                 self.resetFrame()
                 return
-            if (result := self.decoder.decode(data)) is None:
+            if (result := self.decoder.decode(bytes(data))) is None:
                 self.resetFrame()
                 raise ModbusIOException("Unable to decode request")
             self.populateResult(result)
-            self._buffer = self._buffer[used_len:]
+            used += used_len
             self._header = {"tid": 0, "pid": 0, "len": 0, "uid": 0}
             if tid and tid != result.transaction_id:
                 self.resetFrame()
-            else:
-                callback(result)  # defer or push to a thread?
+                return
+            callback(result)  # defer or push to a thread?
+        self._buffer = self._buffer[used:]
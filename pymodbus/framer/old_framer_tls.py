@@ -52,18 +52,21 @@ class ModbusTlsFramer(ModbusFramer):
         """Process new packet pattern."""
         # no slave id for Modbus Security Application Protocol
 
-        while True:
-            used_len, use_tid, dev_id, data = self.message_handler.decode(self._buffer)
+        used = 0
+        view = memoryview(self._buffer)
+        while used < len(self._buffer):
+            used_len, use_tid, dev_id, data = self.message_handler.decode(view[used:])
             if not data:
-                return
+                break
             self._header["uid"] = dev_id
             self._header["tid"] = use_tid
             self._header["pid"] = 0
 
-            if (result := self.decoder.decode(data)) is None:
+            if (result := self.decoder.decode(bytes(data))) is None:
                 self.resetFrame()
                 raise ModbusIOException("Unable to decode request")
             self.populateResult(result)
-            self._buffer = self._buffer[used_len:]
+            used += used_len
             self._header = {"tid": 0, "pid": 0, "len": 0, "uid": 0}
             callback(result)  # defer or push to a thread?
+        self._buffer = self._buffer[used:]
@@ -21,7 +21,8 @@ class FramerRaw(FramerBase):
     def decode(self, data: bytes) -> tuple[int, int, int, bytes]:
         """Decode ADU."""
         if len(data) < self.MIN_SIZE:
-            Log.debug("Short frame: {} wait for more data", data, ":hex")
+            if Log.hot_path:
+                Log.debug("Short frame: {} wait for more data", data, ":hex")
             return 0, 0, 0, self.EMPTY
         dev_id = int(data[0])
         tid = int(data[1])
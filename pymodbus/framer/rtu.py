@@ -1,14 +1,25 @@
 """Modbus RTU frame implementation."""
 from __future__ import annotations
 
+import importlib
 import struct
+from collections.abc import Callable
 
-from pymodbus.exceptions import ModbusIOException
-from pymodbus.factory import ClientDecoder
 from pymodbus.framer.base import FramerBase
 from pymodbus.logging import Log
 
 
+try:
+    # optional C implementation, pip install pymodbus[crc]
+    if not importlib.import_module("crcmod.crcmod")._usingExtension:  # pylint: disable=protected-access
+        raise ImportError("crcmod without C extension")
+    CRC16_NATIVE: Callable[[bytes], int] | None = importlib.import_module(
+        "crcmod.predefined"
+    ).mkPredefinedCrcFun("modbus")
+except ImportError:
+    CRC16_NATIVE = None
+
+
 class FramerRTU(FramerBase):
     """Modbus RTU frame type.
 
@@ -20,18 +31,21 @@ class FramerRTU(FramerBase):
     """
 
     MIN_SIZE = 5
+    MAX_SIZE = 256  # <device id> + pdu (max 253) + <crc 2 bytes>
 
     def __init__(self) -> None:
         """Initialize a ADU instance."""
         super().__init__()
         self.broadcast: bool = False
-        self.dev_ids: list[int]
-        self.fc_calc: dict[int, int]
+        self.dev_ids: list[int] = []
+        self.fc_calc: dict[int, int] = {}
+        self.crc_errors = 0
+        self._scan = 0
+        self._candidates: list[list[int]] = []
 
     def set_dev_ids(self, dev_ids: list[int]):
         """Set/update allowed device ids."""
-        if 0 in dev_ids:
-            self.broadcast = True
+        self.broadcast = 0 in dev_ids
         self.dev_ids = dev_ids
 
     def set_fc_calc(self, fc: int, msg_size: int, count_pos: int):
@@ -58,121 +72,115 @@ class FramerRTU(FramerBase):
         return result
     crc16_table: list[int] = [0]
 
-    def _legacy_decode(self, callback, slave):  # noqa: C901
-        """Process new packet pattern."""
-
-        def is_frame_ready(self):
-            """Check if we should continue decode logic."""
-            size = self._header.get("len", 0)
-            if not size and len(self._buffer) > self._hsize:
-                try:
-                    self._header["uid"] = int(self._buffer[0])
-                    self._header["tid"] = int(self._buffer[0])
-                    func_code = int(self._buffer[1])
-                    pdu_class = self.decoder.lookupPduClass(func_code)
-                    size = pdu_class.calculateRtuFrameSize(self._buffer)
-                    self._header["len"] = size
-
-                    if len(self._buffer) < size:
-                        raise IndexError
-                    self._header["crc"] = self._buffer[size - 2 : size]
-                except IndexError:
-                    return False
-            return len(self._buffer) >= size if size > 0 else False
-
-        def get_frame_start(self, slaves, broadcast, skip_cur_frame):
-            """Scan buffer for a relevant frame start."""
-            start = 1 if skip_cur_frame else 0
-            if (buf_len := len(self._buffer)) < 4:
-                return False
-            for i in range(start, buf_len - 3):  # <slave id><function code><crc 2 bytes>
-                if not broadcast and self._buffer[i] not in slaves:
+    @classmethod
+    def generate_crc16_table_wide(cls) -> list[int]:
+        """Generate a crc16 lookup table, indexed by 2 bytes (little endian).
+
+        .. note:: This is generated at first use (65536 entries)
+        """
+        table = cls.crc16_table
+        table2 = [(crc >> 8) ^ table[crc & 0xFF] for crc in table]
+        return [low ^ high for high in table for low in table2]
+    crc16_table_wide: list[int] = []
+
+    def frame_size(self, data: bytes | memoryview) -> int:
+        """Return size of the frame starting at data[0].
+
+        :param data: buffer, starting with <device id><function code>
+        :returns: frame size, 0 if more data is needed, -1 if not a frame start
+        """
+        if (calc := self.fc_calc.get(data[1])) is None:
+            return 5 if (data[1] & 0x7F) in self.fc_calc else -1
+        if calc > 0:
+            return calc
+        if len(data) <= -calc:
+            return 0
+        size = data[-calc] - calc + 3
+        return size if size <= self.MAX_SIZE else -1
+
+    def hunt_frame(self, data: bytes | memoryview) -> tuple[int, int]:
+        """Find the first valid frame in data.
+
+        The scanning state is kept between calls, so data must be the
+        same buffer (extended with new data) until :meth:`consume` or
+        :meth:`reset` is called. Each byte is checked once as a
+        possible frame start, the CRC of each candidate is updated
+        with the new bytes only, and verified when the candidate is
+        complete (the CRC register of a frame including its CRC is 0).
+        A candidate is dropped if its size is still unknown when
+        MAX_SIZE bytes are received, so noise costs linear time.
+
+        :param data: receive buffer
+        :returns: (start, end) of the frame, or (keep, 0) if no frame
+            is complete, bytes before keep cannot be part of a frame.
+        """
+        size = len(data)
+        data = memoryview(data)
+        pos = self._scan
+        while pos < size - 1:
+            if self.broadcast or data[pos] in self.dev_ids:
+                self._candidates.append([pos, 0, 0xFFFF, pos])
+            pos += 1
+        self._scan = pos
+        live = []
+        for cand in self._candidates:
+            start, length, crc, fed = cand
+            if not length:
+                if not (length := self.frame_size(data[start:])):
+                    if size - start < self.MAX_SIZE:
+                        live.append(cand)
                     continue
-                if (
-                    self._buffer[i + 1] not in self.function_codes
-                    and (self._buffer[i + 1] - 0x80) not in self.function_codes
-                ):
+                if not 4 <= length <= self.MAX_SIZE:  # <device id><function code><crc 2 bytes>
                     continue
-                if i:
-                    self._buffer = self._buffer[i:]  # remove preceding trash.
-                return True
-            if buf_len > 3:
-                self._buffer = self._buffer[-3:]
-            return False
-
-        def check_frame(self):
-            """Check if the next frame is available."""
-            try:
-                self._header["uid"] = int(self._buffer[0])
-                self._header["tid"] = int(self._buffer[0])
-                func_code = int(self._buffer[1])
-                pdu_class = self.decoder.lookupPduClass(func_code)
-                size = pdu_class.calculateRtuFrameSize(self._buffer)
-                self._header["len"] = size
-
-                if len(self._buffer) < size:
-                    raise IndexError
-                self._header["crc"] = self._buffer[size - 2 : size]
-                frame_size = self._header["len"]
-                data = self._buffer[: frame_size - 2]
-                crc = self._header["crc"]
-                crc_val = (int(crc[0]) << 8) + int(crc[1])
-                return FramerRTU.check_CRC(data, crc_val)
-            except (IndexError, KeyError, struct.error):
-                return False
-
-        self._buffer = b''  # pylint: disable=attribute-defined-outside-init
-        broadcast = not slave[0]
-        skip_cur_frame = False
-        while get_frame_start(self, slave, broadcast, skip_cur_frame):
-            self._header: dict = {"uid": 0x00, "len": 0, "crc": b"\x00\x00"}  # pylint: disable=attribute-defined-outside-init
-            if not is_frame_ready(self):
-                Log.debug("Frame - not ready")
-                break
-            if not check_frame(self):
-                Log.debug("Frame check failed, ignoring!!")
-                # x = self._buffer
-                # self.resetFrame()
-                # self._buffer = x
-                skip_cur_frame = True
-                continue
-            start = 0x01  # self._hsize
-            end = self._header["len"] - 2
-            buffer = self._buffer[start:end]
-            if end > 0:
-                Log.debug("Getting Frame - {}", buffer, ":hex")
-                data = buffer
+                cand[1] = length
+            end = min(start + length, size)
+            if fed < end:
+                crc = cand[2] = self.update_CRC(crc, data[fed:end])
+                cand[3] = end
+            if end < start + length:
+                live.append(cand)
+            elif not crc:
+                return start, end
             else:
-                data = b""
-            if (result := ClientDecoder().decode(data)) is None:
-                raise ModbusIOException("Unable to decode request")
-            result.slave_id = self._header["uid"]
-            result.transaction_id = self._header["tid"]
-            self._buffer = self._buffer[self._header["len"] :]  # pylint: disable=attribute-defined-outside-init
-            Log.debug("Frame advanced, resetting header!!")
-            callback(result)  # defer or push to a thread?
-
-
-    def hunt_frame_start(self, skip_cur_frame: bool, data: bytes) -> int:
-        """Scan buffer for a relevant frame start."""
-        buf_len = len(data)
-        for i in range(1 if skip_cur_frame else 0, buf_len - self.MIN_SIZE):
-            if not (self.broadcast or data[i] in self.dev_ids):
-                continue
-            if (_fc := data[i + 1]) not in self.fc_calc:
-                continue
-            return i
-        return -i
+                self.crc_errors += 1
+                if Log.hot_path:
+                    Log.debug("Frame check failed, ignoring!!")
+        self._candidates = live
+        return (live[0][0] if live else pos), 0
 
-    def decode(self, data: bytes) -> tuple[int, int, int, bytes]:
-        """Decode ADU."""
-        if len(data) < self.MIN_SIZE:
-            return 0, 0, 0, b''
+    def consume(self, used: int) -> None:
+        """Remove used bytes from the start of the buffer.
 
-        while (i := self.hunt_frame_start(False, data)) > 0:
-            pass
-        return -i, 0, 0, b''
+        Candidates starting in the removed bytes are dropped.
 
+        :param used: number of bytes removed
+        """
+        self._scan = max(self._scan - used, 0)
+        self._candidates = [
+            [start - used, length, crc, fed - used]
+            for start, length, crc, fed in self._candidates
+            if start >= used
+        ]
+
+    def reset(self) -> None:
+        """Forget the scanning state (buffer cleared)."""
+        self._scan = 0
+        self._candidates = []
+
+    @property
+    def pending(self) -> bool:
+        """Return True if an incomplete frame is waiting for data."""
+        return bool(self._candidates)
+
+    def decode(self, data: bytes) -> tuple[int, int, int, bytes]:
+        """Decode ADU."""
+        start, end = self.hunt_frame(data)
+        if not end:
+            if start:
+                self.consume(start)
+            return start, 0, 0, self.EMPTY
+        self.consume(end)
+        return end, 0, data[start], bytes(data[start + 1 : end - 2])
 
     def encode(self, pdu: bytes, device_id: int, _tid: int) -> bytes:
         """Encode ADU."""
@@ -190,20 +198,46 @@ class FramerRTU(FramerBase):
         return cls.compute_CRC(data) == check
 
     @classmethod
-    def compute_CRC(cls, data: bytes) -> int:
+    def compute_CRC(cls, data: bytes | bytearray | memoryview) -> int:
         """Compute a crc16 on the passed in bytes.
 
         The difference between modbus's crc16 and a normal crc16
         is that modbus starts the crc value out at 0xffff.
 
+        The C implementation (crcmod) is used if installed, otherwise
+        2 bytes are handled per lookup in crc16_table_wide.
+
         :param data: The data to create a crc16 of
         :returns: The calculated CRC
         """
-        crc = 0xFFFF
-        for data_byte in data:
-            idx = cls.crc16_table[(crc ^ int(data_byte)) & 0xFF]
-            crc = ((crc >> 8) & 0xFF) ^ idx
-        swapped = ((crc << 8) & 0xFF00) | ((crc >> 8) & 0x00FF)
-        return swapped
+        if CRC16_NATIVE:
+            crc = CRC16_NATIVE(bytes(data))
+            return ((crc << 8) & 0xFF00) | (crc >> 8)
+        crc = cls._update_crc16(0xFFFF, data)
+        return ((crc << 8) & 0xFF00) | (crc >> 8)
+
+    @classmethod
+    def update_CRC(cls, crc: int, data: bytes | bytearray | memoryview) -> int:
+        """Continue a crc16 over the passed in bytes.
+
+        :param crc: crc16 register (0xFFFF to start), not byte swapped
+        :param data: The data to add
+        :returns: The crc16 register, 0 if data ended with a matching CRC
+        """
+        if CRC16_NATIVE:
+            return CRC16_NATIVE(bytes(data), crc)  # type: ignore[call-arg]
+        return cls._update_crc16(crc, data)
+
+    @classmethod
+    def _update_crc16(cls, crc: int, data: bytes | bytearray | memoryview) -> int:
+        """Update crc16 register, 2 bytes per lookup."""
+        if not (table := cls.crc16_table_wide):
+            table = cls.crc16_table_wide = cls.generate_crc16_table_wide()
+        words = len(data) >> 1
+        for word in struct.unpack_from(f"<{words}H", data):
+            crc = table[word ^ crc]
+        if len(data) & 0x01:
+            crc = (crc >> 8) ^ cls.crc16_table[(crc ^ data[-1]) & 0xFF]
+        return crc
 
 FramerRTU.crc16_table = FramerRTU.generate_crc16_table()
@@ -20,13 +20,15 @@ class FramerSocket(FramerBase):
     def decode(self, data: bytes) -> tuple[int, int, int, bytes]:
         """Decode ADU."""
         if (used_len := len(data)) < self.MIN_SIZE:
-          Log.debug("Very short frame (NO MBAP): {} wait for more data", data, ":hex")
+          if Log.hot_path:
+            Log.debug("Very short frame (NO MBAP): {} wait for more data", data, ":hex")
           return 0, 0, 0, self.EMPTY
         msg_tid = int.from_bytes(data[0:2], 'big')
         msg_len = int.from_bytes(data[4:6], 'big') + 6
         msg_dev = int(data[6])
         if used_len < msg_len:
-          Log.debug("Short frame: {} wait for more data", data, ":hex")
+          if Log.hot_path:
+            Log.debug("Short frame: {} wait for more data", data, ":hex")
           return 0, 0, 0, self.EMPTY
         if msg_len == 8 and used_len == 9:
             msg_len = 9
@@ -5,10 +5,11 @@ Released under the BSD license
 from __future__ import annotations
 
 import logging
+import os
 from binascii import b2a_hex
 from logging import NullHandler as __null
 
-from pymodbus.utilities import hexlify_packets
+from pymodbus.utilities import ModbusTransactionState, hexlify_packets
 
 
 # ---------------------------------------------------------------------------#
@@ -32,13 +33,35 @@ def pymodbus_apply_logging_config(
     Log.apply_logging_config(level, log_file_name)
 
 
+def pymodbus_hot_path_logging(enable: bool = True):
+    """Enable/disable debug logging in the hot path (done per frame/request).
+
+    :param enable: False to skip the hot path debug calls completely.
+
+    When disabled, the debug calls in transport, framers, decoders and
+    datastore are not called at all (not even the argument handling),
+    independent of the log level, saving CPU in busy servers/clients.
+
+    Can also be disabled at startup with the environment variable
+    PYMODBUS_HOT_PATH_LOGGING=0
+    """
+    Log.hot_path = enable
+
+
 class Log:
     """Class to hide logging complexity.
 
+    Debug calls in the hot path are guarded with "if Log.hot_path:"
+
     :meta private:
     """
 
     _logger = logging.getLogger(__name__)
+    hot_path = os.environ.get("PYMODBUS_HOT_PATH_LOGGING", "1").lower() not in (
+        "0",
+        "off",
+        "false",
+    )
 
     @classmethod
     def apply_logging_config(cls, level, log_file_name):
@@ -85,6 +108,8 @@ class Log:
                     string_args.append(str(args[i]))
                 elif args[i + 1] == ":b2a":
                     string_args.append(b2a_hex(args[i]))
+                elif args[i + 1] == ":state":
+                    string_args.append(ModbusTransactionState.to_string(args[i]))
                 skip = True
             else:
                 string_args.append(args[i])
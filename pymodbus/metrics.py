@@ -0,0 +1,273 @@
+"""Request metrics for clients and servers.
+
+Metrics are collected per connection, and within a connection per
+(slave id, function code), when a :class:`ModbusMetrics` object is passed
+to a client or server (parameter metrics=).
+
+The counters are plain integers updated inline, and latencies are kept
+in a fixed precision histogram, so collecting costs a few attribute
+updates per request and can stay enabled in production.
+
+The metrics are pulled with :meth:`ModbusMetrics.snapshot` (json friendly
+dict) or :meth:`ModbusMetrics.prometheus` (text exposition format).
+"""
+from __future__ import annotations
+
+import time
+
+from pymodbus.pdu import ModbusPDU
+
+
+class ModbusLatencyHistogram:
+    """Latency histogram with HDR style (log linear) buckets.
+
+    Latencies are recorded in microseconds. Values below 32us are kept
+    exact, larger values in 16 buckets per power of 2, giving a precision
+    better than 6.25% from 1us to 1 hour in less than 500 counters.
+    """
+
+    SUB_BITS = 4
+    SUB_COUNT = 1 << SUB_BITS
+
+    def __init__(self) -> None:
+        """Initialize empty histogram."""
+        self.counts: list[int] = []
+        self.count = 0
+        self.total = 0
+        self.min = 0
+        self.max = 0
+
+    def record(self, seconds: float) -> None:
+        """Add a latency.
+
+        :param seconds: latency
+        """
+        usec = max(int(seconds * 1_000_000), 0)
+        if usec < 2 * self.SUB_COUNT:
+            index = usec
+        else:
+            shift = usec.bit_length() - self.SUB_BITS - 1
+            index = ((shift + 1) << self.SUB_BITS) + (usec >> shift)
+            index -= self.SUB_COUNT
+        if index >= len(self.counts):
+            self.counts.extend([0] * (index + 1 - len(self.counts)))
+        self.counts[index] += 1
+        if not self.count or usec < self.min:
+            self.min = usec
+        if usec > self.max:
+            self.max = usec
+        self.count += 1
+        self.total += usec
+
+    def bucket_limit(self, index: int) -> int:
+        """Return highest value (us) counted in bucket.
+
+        :param index: bucket index
+        """
+        if index < 2 * self.SUB_COUNT:
+            return index
+        shift = (index >> self.SUB_BITS) - 1
+        low = (self.SUB_COUNT + (index & (self.SUB_COUNT - 1))) << shift
+        return low + (1 << shift) - 1
+
+    def percentile(self, percent: float) -> float:
+        """Return latency (seconds) below which percent of the values are.
+
+        :param percent: 0-100
+        """
+        if not self.count:
+            return 0.0
+        target = max(self.count * percent / 100, 1)
+        seen = 0
+        for index, count in enumerate(self.counts):
+            seen += count
+            if seen >= target:
+                return min(self.bucket_limit(index), self.max) / 1_000_000
+        return self.max / 1_000_000
+
+    def to_dict(self) -> dict[str, float]:
+        """Return summary (seconds)."""
+        return {
+            "count": self.count,
+            "mean": self.total / self.count / 1_000_000 if self.count else 0.0,
+            "min": self.min / 1_000_000,
+            "max": self.max / 1_000_000,
+            "p50": self.percentile(50),
+            "p90": self.percentile(90),
+            "p99": self.percentile(99),
+            "p999": self.percentile(99.9),
+        }
+
+
+class ModbusRequestStats:
+    """Counters for one (slave id, function code) on a connection."""
+
+    __slots__ = ("requests", "errors", "timeouts", "retries", "latency")
+
+    def __init__(self) -> None:
+        """Initialize counters."""
+        self.requests = 0
+        self.errors = 0
+        self.timeouts = 0
+        self.retries = 0
+        self.latency = ModbusLatencyHistogram()
+
+    def done(self, start: float, response) -> None:
+        """Count a completed request.
+
+        :param start: time.perf_counter() when the request was started
+        :param response: response (None for broadcast, raw bytes are not checked)
+        """
+        self.latency.record(time.perf_counter() - start)
+        if isinstance(response, ModbusPDU) and response.isError():
+            self.errors += 1
+
+    def to_dict(self) -> dict:
+        """Return counters."""
+        return {
+            "requests": self.requests,
+            "errors": self.errors,
+            "timeouts": self.timeouts,
+            "retries": self.retries,
+            "latency": self.latency.to_dict(),
+        }
+
+
+class ModbusConnectionStats:
+    """Counters for one connection (client: remote host, server: peer host).
+
+    queue_depth is the number of requests in progress on the connection
+    (client: waiting to be sent or for a response, server: being executed),
+    queue_depth_max the highest value seen.
+    """
+
+    def __init__(self, name: str) -> None:
+        """Initialize counters.
+
+        :param name: connection name
+        """
+        self.name = name
+        self.bytes_in = 0
+        self.bytes_out = 0
+        self.crc_errors = 0
+        self.queue_depth = 0
+        self.queue_depth_max = 0
+        self.requests: dict[tuple[int, int], ModbusRequestStats] = {}
+
+    def request(self, slave: int, function_code: int) -> ModbusRequestStats:
+        """Return request counters, and count the request.
+
+        :param slave: slave id
+        :param function_code: request function code
+        """
+        if (stats := self.requests.get((slave, function_code))) is None:
+            stats = self.requests[(slave, function_code)] = ModbusRequestStats()
+        stats.requests += 1
+        return stats
+
+    def enqueue(self) -> None:
+        """Count request in progress."""
+        self.queue_depth += 1
+        if self.queue_depth > self.queue_depth_max:
+            self.queue_depth_max = self.queue_depth
+
+    def dequeue(self) -> None:
+        """Count request finished."""
+        self.queue_depth -= 1
+
+    def reset(self) -> None:
+        """Zero counters, requests in progress are kept."""
+        self.bytes_in = 0
+        self.bytes_out = 0
+        self.crc_errors = 0
+        self.queue_depth_max = self.queue_depth
+        self.requests.clear()
+
+    def to_dict(self) -> dict:
+        """Return counters."""
+        return {
+            "bytes_in": self.bytes_in,
+            "bytes_out": self.bytes_out,
+            "crc_errors": self.crc_errors,
+            "queue_depth": self.queue_depth,
+            "queue_depth_max": self.queue_depth_max,
+            "requests": [
+                {"slave": slave, "function_code": function_code, **stats.to_dict()}
+                for (slave, function_code), stats in sorted(self.requests.items())
+            ],
+        }
+
+
+class ModbusMetrics:
+    """Metrics registry, can be shared by several clients/servers.
+
+    Example::
+
+        metrics = ModbusMetrics()
+        client = AsyncModbusTcpClient("plc1", metrics=metrics)
+        ...
+        print(metrics.snapshot())
+    """
+
+    QUANTILES = (("0.5", 50), ("0.9", 90), ("0.99", 99), ("1", 100))
+
+    def __init__(self) -> None:
+        """Initialize registry."""
+        self.connections: dict[str, ModbusConnectionStats] = {}
+
+    def connection(self, name: str) -> ModbusConnectionStats:
+        """Return connection counters, created at first call.
+
+        :param name: connection name
+        """
+        if (stats := self.connections.get(name)) is None:
+            stats = self.connections[name] = ModbusConnectionStats(name)
+        return stats
+
+    def snapshot(self) -> dict:
+        """Return all metrics as a json friendly dict.
+
+        latencies are in seconds.
+        """
+        return {
+            "time": time.time(),
+            "connections": {
+                name: stats.to_dict() for name, stats in self.connections.items()
+            },
+        }
+
+    def prometheus(self) -> str:
+        """Return all metrics in prometheus text exposition format."""
+        lines: list[str] = []
+
+        def add(name, kind, samples):
+            lines.append(f"# TYPE pymodbus_{name} {kind}")
+            lines.extend(f"pymodbus_{name}{{{labels}}} {value}" for labels, value in samples)
+
+        conns = [(f'connection="{name}"', stats) for name, stats in self.connections.items()]
+        add("bytes_in_total", "counter", [(lbl, conn.bytes_in) for lbl, conn in conns])
+        add("bytes_out_total", "counter", [(lbl, conn.bytes_out) for lbl, conn in conns])
+        add("crc_errors_total", "counter", [(lbl, conn.crc_errors) for lbl, conn in conns])
+        add("queue_depth", "gauge", [(lbl, conn.queue_depth) for lbl, conn in conns])
+        reqs = [
+            (f'{lbl},slave="{slave}",function_code="{fc}"', stats)
+            for lbl, conn in conns
+            for (slave, fc), stats in sorted(conn.requests.items())
+        ]
+        for counter in ModbusRequestStats.__slots__[:-1]:
+            add(f"{counter}_total", "counter", [(lbl, getattr(stats, counter)) for lbl, stats in reqs])
+        lines.append("# TYPE pymodbus_latency_seconds summary")
+        for lbl, stats in reqs:
+            hist = stats.latency
+            lines.extend(
+                f'pymodbus_latency_seconds{{{lbl},quantile="{quantile}"}} {hist.percentile(percent)}'
+                for quantile, percent in self.QUANTILES
+            )
+            lines.append(f"pymodbus_latency_seconds_sum{{{lbl}}} {hist.total / 1_000_000}")
+            lines.append(f"pymodbus_latency_seconds_count{{{lbl}}} {hist.count}")
+        return "\n".join(lines) + "\n"
+
+    def reset(self) -> None:
+        """Zero all metrics."""
+        for stats in self.connections.values():
+            stats.reset()
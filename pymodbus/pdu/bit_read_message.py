@@ -13,13 +13,14 @@ import struct
 
 from pymodbus.pdu import ModbusExceptions as merror
 from pymodbus.pdu import ModbusRequest, ModbusResponse
-from pymodbus.utilities import pack_bitstring, unpack_bitstring
+from pymodbus.utilities import PackedBits, pack_bitstring, unpack_bitstring
 
 
 class ReadBitsRequestBase(ModbusRequest):
     """Base class for Messages Requesting bit values."""
 
     _rtu_frame_size = 8
+    decode_sets_all = True
 
     def __init__(self, address, count, slave=0, **kwargs):
         """Initialize the read request data.
@@ -71,9 +72,13 @@ class ReadBitsResponseBase(ModbusResponse):
     """Base class for Messages responding to bit-reading values.
 
     The requested bits can be found in the .bits list.
+
+    Set bits_as_packed = True (class attribute) to decode the bits
+    into a PackedBits instead of a list of bools.
     """
 
     _rtu_byte_count_pos = 2
+    bits_as_packed = False
 
     def __init__(self, values, slave=0, **kwargs):
         """Initialize a new instance.
@@ -101,7 +106,10 @@ class ReadBitsResponseBase(ModbusResponse):
         :param data: The packet data to decode
         """
         self.byte_count = int(data[0])  # pylint: disable=attribute-defined-outside-init
-        self.bits = unpack_bitstring(data[1:])
+        if self.bits_as_packed:
+            self.bits = PackedBits(data[1:])
+        else:
+            self.bits = unpack_bitstring(data[1:])
 
     def setBit(self, address, value=1):
         """Set the specified bit.
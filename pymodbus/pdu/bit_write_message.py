@@ -48,6 +48,7 @@ class WriteSingleCoilRequest(ModbusRequest):
     function_code_name = "write_coil"
 
     _rtu_frame_size = 8
+    decode_sets_all = True
 
     def __init__(self, address=None, value=None, slave=None, **kwargs):
         """Initialize a new instance.
@@ -90,8 +91,9 @@ class WriteSingleCoilRequest(ModbusRequest):
         if not context.validate(self.function_code, self.address, 1):
             return self.doException(merror.IllegalAddress)
 
-        await context.async_setValues(self.function_code, self.address, [self.value])
-        values = await context.async_getValues(self.function_code, self.address, 1)
+        values = await context.async_setValues(self.function_code, self.address, [self.value])
+        if values is None:
+            values = await context.async_getValues(self.function_code, self.address, 1)
         return WriteSingleCoilResponse(self.address, values[0])
 
     def get_response_pdu_size(self):
@@ -172,6 +174,7 @@ class WriteMultipleCoilsRequest(ModbusRequest):
     function_code = 15
     function_code_name = "write_coils"
     _rtu_byte_count_pos = 6
+    decode_sets_all = True
 
     def __init__(self, address=None, values=None, slave=None, **kwargs):
         """Initialize a new instance.
@@ -98,9 +98,18 @@ class ModbusPDU:
 
 
 class ModbusRequest(ModbusPDU):
-    """Base class for a modbus request PDU."""
+    """Base class for a modbus request PDU.
+
+    .. attribute:: decode_sets_all
+
+       True if decode() sets all attributes, which __init__() sets
+       (apart from the ModbusPDU header fields), this allows a server
+       request pool to reuse the object without calling __init__().
+       A subclass which adds attributes in __init__() must set it False.
+    """
 
     function_code = -1
+    decode_sets_all = False
 
     def __init__(self, slave=0, **kwargs):  # pylint: disable=useless-parent-delegation
         """Proxy to the lower level initializer.
@@ -15,12 +15,14 @@ import struct
 
 from pymodbus.pdu import ModbusExceptions as merror
 from pymodbus.pdu import ModbusRequest, ModbusResponse
+from pymodbus.utilities import pack_registers, unpack_registers
 
 
 class ReadRegistersRequestBase(ModbusRequest):
     """Base class for reading a modbus register."""
 
     _rtu_frame_size = 8
+    decode_sets_all = True
 
     def __init__(self, address, count, slave=0, **kwargs):
         """Initialize a new instance.
@@ -66,9 +68,13 @@ class ReadRegistersResponseBase(ModbusResponse):
     """Base class for responding to a modbus register read.
 
     The requested registers can be found in the .registers list.
+
+    Set registers_as_array = True (class attribute) to decode the
+    registers into an array("H") instead of a list.
     """
 
     _rtu_byte_count_pos = 2
+    registers_as_array = False
 
     def __init__(self, values, slave=0, **kwargs):
         """Initialize a new instance.
@@ -86,10 +92,9 @@ class ReadRegistersResponseBase(ModbusResponse):
 
         :returns: The encoded packet
         """
-        result = struct.pack(">B", len(self.registers) * 2)
-        for register in self.registers:
-            result += struct.pack(">H", register)
-        return result
+        return struct.pack(">B", len(self.registers) * 2) + pack_registers(
+            self.registers
+        )
 
     def decode(self, data):
         """Decode a register response packet.
@@ -97,9 +102,11 @@ class ReadRegistersResponseBase(ModbusResponse):
         :param data: The request to decode
         """
         byte_count = int(data[0])
-        self.registers = []
-        for i in range(1, byte_count + 1, 2):
-            self.registers.append(struct.unpack(">H", data[i : i + 2])[0])
+        if len(data) <= byte_count:
+            raise struct.error(f"byte count {byte_count}, only {len(data) - 1} bytes")
+        self.registers = unpack_registers(
+            data[1 : byte_count + 1], as_array=self.registers_as_array
+        )
 
     def getRegister(self, index):
         """Get the requested register.
@@ -256,6 +263,7 @@ class ReadWriteMultipleRegistersRequest(ModbusRequest):
     function_code = 23
     function_code_name = "read_write_multiple_registers"
     _rtu_byte_count_pos = 10
+    decode_sets_all = True
 
     def __init__(self, **kwargs):
         """Initialize a new request message.
@@ -288,9 +296,7 @@ class ReadWriteMultipleRegistersRequest(ModbusRequest):
             self.write_count,
             self.write_byte_count,
         )
-        for register in self.write_registers:
-            result += struct.pack(">H", register)
-        return result
+        return result + pack_registers(self.write_registers)
 
     def decode(self, data):
         """Decode the register request packet.
@@ -304,10 +310,13 @@ class ReadWriteMultipleRegistersRequest(ModbusRequest):
             self.write_count,
             self.write_byte_count,
         ) = struct.unpack(">HHHHB", data[:9])
-        self.write_registers = []
-        for i in range(9, self.write_byte_count + 9, 2):
-            register = struct.unpack(">H", data[i : i + 2])[0]
-            self.write_registers.append(register)
+        if len(data) < self.write_byte_count + 9:
+            raise struct.error(
+                f"byte count {self.write_byte_count}, only {len(data) - 9} bytes"
+            )
+        self.write_registers = unpack_registers(
+            data[9 : (self.write_byte_count & ~1) + 9]
+        )
 
     async def execute(self, context):
         """Run a write single register request against a datastore.
@@ -386,10 +395,9 @@ class ReadWriteMultipleRegistersResponse(ModbusResponse):
 
         :returns: The encoded packet
         """
-        result = struct.pack(">B", len(self.registers) * 2)
-        for register in self.registers:
-            result += struct.pack(">H", register)
-        return result
+        return struct.pack(">B", len(self.registers) * 2) + pack_registers(
+            self.registers
+        )
 
     def decode(self, data):
         """Decode the register response packet.
@@ -397,8 +405,7 @@ class ReadWriteMultipleRegistersResponse(ModbusResponse):
         :param data: The response to decode
         """
         bytecount = int(data[0])
-        for i in range(1, bytecount, 2):
-            self.registers.append(struct.unpack(">H", data[i : i + 2])[0])
+        self.registers.extend(unpack_registers(data[1 : bytecount + 1]))
 
     def __str__(self):
         """Return a string representation of the instance.
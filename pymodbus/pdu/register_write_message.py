@@ -14,6 +14,7 @@ import struct
 
 from pymodbus.pdu import ModbusExceptions as merror
 from pymodbus.pdu import ModbusRequest, ModbusResponse
+from pymodbus.utilities import pack_registers, unpack_registers
 
 
 class WriteSingleRegisterRequest(ModbusRequest):
@@ -27,6 +28,7 @@ class WriteSingleRegisterRequest(ModbusRequest):
     function_code = 6
     function_code_name = "write_register"
     _rtu_frame_size = 8
+    decode_sets_all = True
 
     def __init__(self, address=None, value=None, slave=None, **kwargs):
         """Initialize a new instance.
@@ -68,10 +70,11 @@ class WriteSingleRegisterRequest(ModbusRequest):
         if not context.validate(self.function_code, self.address, 1):
             return self.doException(merror.IllegalAddress)
 
-        await context.async_setValues(
+        values = await context.async_setValues(
             self.function_code, self.address, [self.value]
         )
-        values = await context.async_getValues(self.function_code, self.address, 1)
+        if values is None:
+            values = await context.async_getValues(self.function_code, self.address, 1)
         return WriteSingleRegisterResponse(self.address, values[0])
 
     def get_response_pdu_size(self):
@@ -159,6 +162,7 @@ class WriteMultipleRegistersRequest(ModbusRequest):
     function_code_name = "write_registers"
     _rtu_byte_count_pos = 6
     _pdu_length = 5  # func + adress1 + adress2 + outputQuant1 + outputQuant2
+    decode_sets_all = True
 
     def __init__(self, address=None, values=None, slave=None, **kwargs):
         """Initialize a new instance.
@@ -184,11 +188,7 @@ class WriteMultipleRegistersRequest(ModbusRequest):
         packet = struct.pack(">HHB", self.address, self.count, self.byte_count)
         if self.skip_encode:
             return packet + b"".join(self.values)
-
-        for value in self.values:
-            packet += struct.pack(">H", value)
-
-        return packet
+        return packet + pack_registers(self.values)
 
     def decode(self, data):
         """Decode a write single register packet packet request.
@@ -196,9 +196,11 @@ class WriteMultipleRegistersRequest(ModbusRequest):
         :param data: The request to decode
         """
         self.address, self.count, self.byte_count = struct.unpack(">HHB", data[:5])
-        self.values = []  # reset
-        for idx in range(5, (self.count * 2) + 5, 2):
-            self.values.append(struct.unpack(">H", data[idx : idx + 2])[0])
+        if len(data) < self.byte_count + 5:
+            raise struct.error(
+                f"byte count {self.byte_count}, only {len(data) - 5} bytes"
+            )
+        self.values = unpack_registers(data[5 : (self.byte_count & ~1) + 5])
 
     async def execute(self, context):
         """Run a write single register request against a datastore.
@@ -294,6 +296,7 @@ class MaskWriteRegisterRequest(ModbusRequest):
     function_code = 0x16
     function_code_name = "mask_write_register"
     _rtu_frame_size = 10
+    decode_sets_all = True
 
     def __init__(self, address=0x0000, and_mask=0xFFFF, or_mask=0x0000, **kwargs):
         """Initialize a new instance.
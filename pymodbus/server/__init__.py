@@ -16,6 +16,7 @@ __all__ = [
     "StartAsyncTcpServer",
     "StartAsyncTlsServer",
     "StartAsyncUdpServer",
+    "StartMultiProcessTcpServer",
     "StartSerialServer",
     "StartTcpServer",
     "StartTlsServer",
@@ -33,6 +34,7 @@ from pymodbus.server.async_io import (
     StartAsyncTcpServer,
     StartAsyncTlsServer,
     StartAsyncUdpServer,
+    StartMultiProcessTcpServer,
     StartSerialServer,
     StartTcpServer,
     StartTlsServer,
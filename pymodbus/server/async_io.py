@@ -3,17 +3,22 @@
 from __future__ import annotations
 
 import asyncio
+import multiprocessing
 import os
+import time
 import traceback
 from contextlib import suppress
 
-from pymodbus.datastore import ModbusServerContext
+from pymodbus.datastore import ModbusServerContext, ModbusSharedServerContext
 from pymodbus.device import ModbusControlBlock, ModbusDeviceIdentification
 from pymodbus.exceptions import NoSuchSlaveException
-from pymodbus.factory import ServerDecoder
+from pymodbus.factory import ModbusRequestPool, ServerDecoder
 from pymodbus.framer import FRAMER_NAME_TO_CLASS, FramerType, ModbusFramer
 from pymodbus.logging import Log
+from pymodbus.metrics import ModbusConnectionStats, ModbusMetrics
 from pymodbus.pdu import ModbusExceptions as merror
+from pymodbus.server.cache import ModbusResponseCache
+from pymodbus.server.faults import ModbusFaultInjector
 from pymodbus.transport import CommParams, CommType, ModbusProtocol
 
 
@@ -50,6 +55,12 @@ class ModbusServerRequestHandler(ModbusProtocol):
         self.handler_task = None  # coroutine to be run on asyncio loop
         self.framer: ModbusFramer
         self.loop = asyncio.get_running_loop()
+        self.stats: ModbusConnectionStats | None = None
+        self.peer = ""
+        self.peer_port: int | None = None
+        self.send_lock = asyncio.Lock()
+        self.request_tasks: set[asyncio.Task] = set()
+        self.request_pool: ModbusRequestPool | None = None
 
     def _log_exception(self):
         """Show log exception."""
@@ -66,10 +77,19 @@ class ModbusServerRequestHandler(ModbusProtocol):
         """Call when connection is succcesfull."""
         try:
             self.running = True
+            decoder = self.server.decoder
+            if self.server.request_pool_size:
+                self.request_pool = ModbusRequestPool(decoder, self.server.request_pool_size)
+                decoder = self.request_pool
             self.framer = self.server.framer(
-                self.server.decoder,
+                decoder,
                 client=None,
             )
+            peer = self.transport.get_extra_info("peername")
+            self.peer = str(peer[0]) if peer else str(self.comm_params.host)
+            self.peer_port = peer[1] if peer else None
+            if self.server.metrics:
+                self.stats = self.server.metrics.connection(self.peer)
 
             # schedule the connection handler on the event loop
             self.handler_task = asyncio.create_task(self.handle())
@@ -121,15 +141,21 @@ class ModbusServerRequestHandler(ModbusProtocol):
             if 0 not in slaves:
                 slaves.append(0)
 
-        Log.debug("Handling data: {}", data, ":hex")
+        if Log.hot_path:
+            Log.debug("Handling data: {}", data, ":hex")
 
         single = self.server.context.single
+        crc_errors = self.framer.message_handler.crc_errors
         self.framer.processIncomingPacket(
             data=data,
             callback=lambda x: self.execute(x, *addr),
             slave=slaves,
             single=single,
         )
+        if self.stats:
+            self._stats(addr[0]).crc_errors += (
+                self.framer.message_handler.crc_errors - crc_errors
+            )
 
     async def handle(self) -> None:
         """Coroutine which represents a single master <=> slave conversation.
@@ -174,9 +200,42 @@ class ModbusServerRequestHandler(ModbusProtocol):
         if self.server.request_tracer:
             self.server.request_tracer(request, *addr)
 
-        asyncio.run_coroutine_threadsafe(self._async_execute(request, *addr), self.loop)
+        task = self.loop.create_task(self._async_execute(request, *addr))
+        self.request_tasks.add(task)
+        task.add_done_callback(self._request_done)
+
+    def _request_done(self, task: asyncio.Task) -> None:
+        """Forget finished request task, and log its exception."""
+        self.request_tasks.discard(task)
+        if not task.cancelled() and (exc := task.exception()):
+            Log.error("Request execution failed: {}", exc)
+
+    def _stats(self, addr) -> ModbusConnectionStats:
+        """Return metrics of the peer (udp: the datagram sender)."""
+        if addr:
+            return self.server.metrics.connection(str(addr[0]))
+        return self.stats  # type: ignore[return-value]
 
     async def _async_execute(self, request, *addr):
+        try:
+            if not self.stats:
+                await self._execute_request(request, *addr)
+                return
+            conn = self._stats(addr[0])
+            stats = conn.request(request.slave_id, request.function_code)
+            conn.enqueue()
+            start = time.perf_counter()
+            try:
+                response = await self._execute_request(request, *addr)
+            finally:
+                conn.dequeue()
+            stats.done(start, response)
+        finally:
+            if self.request_pool:
+                self.request_pool.release(request)
+
+    async def _execute_request(self, request, *addr):
+        """Execute request, send and return response."""
         broadcast = False
         try:
             if self.server.broadcast_enable and not request.slave_id:
@@ -184,15 +243,22 @@ class ModbusServerRequestHandler(ModbusProtocol):
                 # if broadcasting then execute on all slave contexts,
                 # note response will be ignored
                 for slave_id in self.server.context.slaves():
-                    response = await request.execute(self.server.context[slave_id])
+                    context = self.server.context[slave_id]
+                    if self.server.response_cache:
+                        response = await self.server.response_cache.execute(request, context)
+                    else:
+                        response = await request.execute(context)
             else:
                 context = self.server.context[request.slave_id]
-                response = await request.execute(context)
+                if self.server.response_cache:
+                    response = await self.server.response_cache.execute(request, context)
+                else:
+                    response = await request.execute(context)
 
         except NoSuchSlaveException:
             Log.error("requested slave does not exist: {}", request.slave_id)
             if self.server.ignore_missing_slaves:
-                return  # the client will simply timeout waiting for a response
+                return None  # the client will simply timeout waiting for a response
             response = request.doException(merror.GatewayNoResponse)
         except Exception as exc:  # pylint: disable=broad-except
             Log.error(
@@ -208,17 +274,27 @@ class ModbusServerRequestHandler(ModbusProtocol):
             skip_encoding = False
             if self.server.response_manipulator:
                 response, skip_encoding = self.server.response_manipulator(response)
-            self.server_send(response, *addr, skip_encoding=skip_encoding)
+            if self.server.fault_injector:
+                await self.server.fault_injector.send(
+                    self, response, *addr, skip_encoding=skip_encoding
+                )
+            else:
+                self.server_send(response, *addr, skip_encoding=skip_encoding)
+            return response
+        return None
 
     def server_send(self, message, addr, **kwargs):
         """Send message."""
         if kwargs.get("skip_encoding", False):
-            self.send(message, addr=addr)
+            pdu = message
         elif message.should_respond:
             pdu = self.framer.buildPacket(message)
-            self.send(pdu, addr=addr)
         else:
             Log.debug("Skipping sending response!!")
+            return
+        self.send(pdu, addr=addr)
+        if self.stats:
+            self._stats(addr).bytes_out += len(pdu)
 
     async def _recv_(self):
         """Receive data from the network."""
@@ -231,6 +307,8 @@ class ModbusServerRequestHandler(ModbusProtocol):
 
     def callback_data(self, data: bytes, addr: tuple | None = ()) -> int:
         """Handle received data."""
+        if self.stats:
+            self._stats(addr).bytes_in += len(data)
         if addr != ():
             self.receive_queue.put_nowait((data, addr))
         else:
@@ -271,6 +349,10 @@ class ModbusBaseServer(ModbusProtocol):
         self.response_manipulator = response_manipulator
         self.request_tracer = request_tracer
         self.handle_local_echo = False
+        self.response_cache: ModbusResponseCache | None = None
+        self.metrics: ModbusMetrics | None = None
+        self.fault_injector: ModbusFaultInjector | None = None
+        self.request_pool_size = 0
         if isinstance(identity, ModbusDeviceIdentification):
             self.control.Identity.update(identity)
 
@@ -328,6 +410,9 @@ class ModbusTcpServer(ModbusBaseServer):
         broadcast_enable=False,
         response_manipulator=None,
         request_tracer=None,
+        reuse_port=False,
+        response_cache_ttl=0,
+        metrics=None,
     ):
         """Initialize the socket server.
 
@@ -345,6 +430,11 @@ class ModbusTcpServer(ModbusBaseServer):
         :param response_manipulator: Callback method for manipulating the
                                         response
         :param request_tracer: Callback method for tracing
+        :param reuse_port: True to bind with SO_REUSEPORT, allowing several
+                        processes to listen on the same port
+        :param response_cache_ttl: >0 to cache read responses for
+                        response_cache_ttl seconds
+        :param metrics: ModbusMetrics object collecting request metrics
         """
         params = getattr(
             self,
@@ -358,6 +448,7 @@ class ModbusTcpServer(ModbusBaseServer):
             ),
         )
         params.source_address = address
+        params.reuse_port = reuse_port
         super().__init__(
             params,
             context,
@@ -368,6 +459,9 @@ class ModbusTcpServer(ModbusBaseServer):
             identity,
             framer,
         )
+        if response_cache_ttl:
+            self.response_cache = ModbusResponseCache(response_cache_ttl)
+        self.metrics = metrics
 
 
 class ModbusTlsServer(ModbusTcpServer):
@@ -392,6 +486,8 @@ class ModbusTlsServer(ModbusTcpServer):
         broadcast_enable=False,
         response_manipulator=None,
         request_tracer=None,
+        response_cache_ttl=0,
+        metrics=None,
     ):
         """Overloaded initializer for the socket server.
 
@@ -413,6 +509,9 @@ class ModbusTlsServer(ModbusTcpServer):
                         False to treat 0 as any other slave_id
         :param response_manipulator: Callback method for
                         manipulating the response
+        :param response_cache_ttl: >0 to cache read responses for
+                        response_cache_ttl seconds
+        :param metrics: ModbusMetrics object collecting request metrics
         """
         self.tls_setup = CommParams(
             comm_type=CommType.TLS,
@@ -433,6 +532,8 @@ class ModbusTlsServer(ModbusTcpServer):
             broadcast_enable=broadcast_enable,
             response_manipulator=response_manipulator,
             request_tracer=request_tracer,
+            response_cache_ttl=response_cache_ttl,
+            metrics=metrics,
         )
 
 
@@ -454,6 +555,8 @@ class ModbusUdpServer(ModbusBaseServer):
         broadcast_enable=False,
         response_manipulator=None,
         request_tracer=None,
+        response_cache_ttl=0,
+        metrics=None,
     ):
         """Overloaded initializer for the socket server.
 
@@ -471,6 +574,9 @@ class ModbusUdpServer(ModbusBaseServer):
         :param response_manipulator: Callback method for
                             manipulating the response
         :param request_tracer: Callback method for tracing
+        :param response_cache_ttl: >0 to cache read responses for
+                            response_cache_ttl seconds
+        :param metrics: ModbusMetrics object collecting request metrics
         """
         # ----------------
         super().__init__(
@@ -490,6 +596,9 @@ class ModbusUdpServer(ModbusBaseServer):
             identity,
             framer,
         )
+        if response_cache_ttl:
+            self.response_cache = ModbusResponseCache(response_cache_ttl)
+        self.metrics = metrics
 
 
 class ModbusSerialServer(ModbusBaseServer):
@@ -525,6 +634,9 @@ class ModbusSerialServer(ModbusBaseServer):
         :param response_manipulator: Callback method for
                     manipulating the response
         :param request_tracer: Callback method for tracing
+        :param response_cache_ttl: >0 to cache read responses for
+                    response_cache_ttl seconds
+        :param metrics: ModbusMetrics object collecting request metrics
         """
         super().__init__(
             params=CommParams(
@@ -548,6 +660,9 @@ class ModbusSerialServer(ModbusBaseServer):
             framer=framer,
         )
         self.handle_local_echo = kwargs.get("handle_local_echo", False)
+        if kwargs.get("response_cache_ttl", 0):
+            self.response_cache = ModbusResponseCache(kwargs["response_cache_ttl"])
+        self.metrics = kwargs.get("metrics", None)
 
 
 # --------------------------------------------------------------------------- #
@@ -713,6 +828,46 @@ def StartTcpServer(**kwargs):  # pylint: disable=invalid-name
     return asyncio.run(StartAsyncTcpServer(**kwargs))
 
 
+def StartMultiProcessTcpServer(workers=None, **kwargs):  # pylint: disable=invalid-name
+    """Start and run a tcp modbus server in multiple processes.
+
+    Each worker process runs its own StartTcpServer, all bound to the
+    same port with SO_REUSEPORT, the kernel distributes the incoming
+    connections between them.
+
+    Use a ModbusSharedServerContext, to let all workers share the same
+    registers, any other context is copied to each worker.
+
+    With a ModbusSharedServerContext the response cache is disabled
+    (response_cache_ttl), a write in one worker cannot invalidate the
+    cached responses of the other workers.
+
+    :param workers: number of worker processes (default os.cpu_count())
+    :param kwargs: parameters for StartTcpServer
+    """
+    workers = workers or os.cpu_count() or 1
+    if not isinstance(kwargs.get("context"), ModbusSharedServerContext):
+        Log.warning("context is not shared, each worker has its own datastore!")
+    elif kwargs.get("response_cache_ttl"):
+        Log.warning("response cache disabled, workers share the datastore")
+        kwargs["response_cache_ttl"] = 0
+    kwargs["reuse_port"] = True
+    processes = [
+        multiprocessing.Process(target=StartTcpServer, kwargs=kwargs, daemon=True)
+        for _ in range(workers)
+    ]
+    for process in processes:
+        process.start()
+    try:
+        for process in processes:
+            process.join()
+    finally:
+        for process in processes:
+            if process.is_alive():
+                process.terminate()
+                process.join()
+
+
 def StartTlsServer(**kwargs):  # pylint: disable=invalid-name
     """Start and run a serial modbus server."""
     return asyncio.run(StartAsyncTlsServer(**kwargs))
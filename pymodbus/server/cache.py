@@ -0,0 +1,161 @@
+"""Response cache for read requests."""
+from __future__ import annotations
+
+import copy
+import time
+
+
+class ModbusResponseCache:
+    """Read-through cache of read responses, shared by all connections.
+
+    Responses to read coils/discrete inputs/holding registers/input
+    registers are kept for ttl seconds, keyed by
+    (slave context, function code, address, count).
+
+    Cached responses are invalidated:
+
+    - when the ttl expires,
+    - by writes through ModbusSlaveContext.setValues() hitting the range
+      (the cache registers a write listener on the slave contexts),
+    - for other contexts (e.g. RemoteSlaveContext, redis/sql), by any
+      non read request executed by the server for that context.
+
+    Expired responses are swept when new responses are added, so the
+    cache holds at most the responses of one ttl. The responses are
+    indexed per (slave context, store), so a write only checks the
+    responses of the store it hits.
+
+    Useful when many clients poll the same block, and the datastore is
+    slow (remote or database backed).
+
+    Each request gets a (shallow) copy of the cached response.
+
+    .. note:: writes are only seen by the cache of the process executing
+       them, StartMultiProcessTcpServer() disables the cache when the
+       workers share the datastore (ModbusSharedServerContext).
+    """
+
+    read_codes = frozenset((1, 2, 3, 4))
+
+    def __init__(self, ttl: float):
+        """Initialize cache.
+
+        :param ttl: time to live for cached responses (seconds)
+        """
+        self.ttl = ttl
+        self.entries: dict[tuple, tuple] = {}
+        self.index: dict[tuple, set[tuple]] = {}
+        self.listening: set[int] = set()
+        self.hits = 0
+        self.misses = 0
+        self.next_sweep = 0.0
+
+    async def execute(self, request, context):
+        """Execute request, serving read requests from the cache.
+
+        :param request: decoded request
+        :param context: slave context
+        :returns: response
+        """
+        if request.function_code not in self.read_codes:
+            response = await request.execute(context)
+            if id(context) not in self.listening:
+                self.invalidate(context)
+            return response
+        if (response := self.get(context, request)) is None:
+            response = await request.execute(context)
+            self.put(context, request, response)
+        return response
+
+    def get(self, context, request):
+        """Return cached response or None.
+
+        :param context: slave context
+        :param request: read request
+        """
+        key = (context, request.function_code, request.address, request.count)
+        if (entry := self.entries.get(key)) is not None:
+            if entry[0] > time.monotonic():
+                self.hits += 1
+                return copy.copy(entry[1])
+            self.remove(key)
+        self.misses += 1
+        return None
+
+    def put(self, context, request, response) -> None:
+        """Add response to cache.
+
+        :param context: slave context
+        :param request: read request
+        :param response: response from request.execute()
+        """
+        if response.isError():
+            return
+        if id(context) not in self.listening and hasattr(context, "write_listeners"):
+            self.listening.add(id(context))
+            context.write_listeners.append(self.on_write)
+        now = time.monotonic()
+        if now >= self.next_sweep:
+            self.sweep(now)
+            self.next_sweep = now + self.ttl
+        key = (context, request.function_code, request.address, request.count)
+        # (re)insert at the end, to keep the entries in expiry order.
+        self.entries.pop(key, None)
+        self.entries[key] = (now + self.ttl, copy.copy(response))
+        self.index.setdefault((context, context.decode(key[1])), set()).add(key)
+
+    def remove(self, key: tuple) -> None:
+        """Remove cached response.
+
+        :param key: (slave context, function code, address, count)
+        """
+        del self.entries[key]
+        index_key = (key[0], key[0].decode(key[1]))
+        keys = self.index[index_key]
+        keys.discard(key)
+        if not keys:
+            del self.index[index_key]
+
+    def sweep(self, now: float) -> None:
+        """Remove expired responses.
+
+        Entries are added in expiry order, so only the oldest are checked.
+
+        :param now: time.monotonic()
+        """
+        expired = []
+        for key, entry in self.entries.items():
+            if entry[0] > now:
+                break
+            expired.append(key)
+        for key in expired:
+            self.remove(key)
+
+    def on_write(self, context, fc_as_hex, address, count) -> None:
+        """Invalidate cached responses overlapping a write.
+
+        :param context: slave context written to
+        :param fc_as_hex: function code used for writing
+        :param address: first address written
+        :param count: number of values written
+        """
+        end = address + count
+        for key in [
+            key
+            for key in self.index.get((context, context.decode(fc_as_hex)), ())
+            if key[2] < end and address < key[2] + key[3]
+        ]:
+            self.remove(key)
+
+    def invalidate(self, context=None) -> None:
+        """Invalidate cached responses.
+
+        :param context: slave context, None for all
+        """
+        if context is None:
+            self.entries.clear()
+            self.index.clear()
+            return
+        for index_key in [index_key for index_key in self.index if index_key[0] is context]:
+            for key in self.index.pop(index_key):
+                del self.entries[key]
@@ -0,0 +1,129 @@
+"""Fault injection on the server send path."""
+from __future__ import annotations
+
+import asyncio
+import dataclasses
+import random
+
+from pymodbus.logging import Log
+
+
+@dataclasses.dataclass()
+class ModbusFaultProfile:
+    """Faults applied to responses.
+
+    :param delay: seconds to wait before sending
+    :param jitter: random 0..jitter seconds added to delay
+    :param split: send response in split fragments (0/1 = not split)
+    :param split_gap: seconds between fragments
+    :param drop_rate: probability (0-1) of not sending the response
+    :param corrupt_rate: probability (0-1) of flipping a bit in the response
+    """
+
+    delay: float = 0.0
+    jitter: float = 0.0
+    split: int = 0
+    split_gap: float = 0.0
+    drop_rate: float = 0.0
+    corrupt_rate: float = 0.0
+
+    @property
+    def active(self) -> bool:
+        """Return True if any fault is configured."""
+        return bool(
+            self.delay
+            or self.jitter
+            or self.split > 1
+            or self.drop_rate
+            or self.corrupt_rate
+        )
+
+
+class ModbusFaultInjector:
+    """Apply delays, fragmentation, drops and corruption to responses.
+
+    Profiles are selected per connection ("host:port"), with the remote
+    host as fallback and a default for all other peers. Delays are
+    awaited in the task executing the request, so other requests and
+    connections are not blocked, split responses on one connection are
+    sent one at a time so their fragments do not interleave.
+
+    Example::
+
+        server.fault_injector = ModbusFaultInjector(
+            ModbusFaultProfile(delay=0.2, jitter=0.1, drop_rate=0.01)
+        )
+        server.fault_injector.peers["10.0.0.7"] = ModbusFaultProfile(split=3, split_gap=0.05)
+        server.fault_injector.peers["10.0.0.8:50123"] = ModbusFaultProfile(drop_rate=1)
+
+    Pass seed to get a reproducible sequence of drops/corruptions.
+    """
+
+    def __init__(self, default: ModbusFaultProfile | None = None, seed: int | None = None):
+        """Initialize injector.
+
+        :param default: profile for peers not in peers (default: no faults)
+        :param seed: seed for the random generator
+        """
+        self.default = default or ModbusFaultProfile()
+        self.peers: dict[str, ModbusFaultProfile] = {}
+        self.random = random.Random(seed)
+        self.delayed = 0
+        self.dropped = 0
+        self.corrupted = 0
+        self.split = 0
+
+    def profile(self, host: str, port: int | None = None) -> ModbusFaultProfile:
+        """Return profile used for a connection.
+
+        :param host: remote host
+        :param port: remote port
+        """
+        if port is not None and (profile := self.peers.get(f"{host}:{port}")):
+            return profile
+        return self.peers.get(host, self.default)
+
+    async def send(self, handler, message, addr, skip_encoding=False) -> None:
+        """Send response through the fault profile of the peer.
+
+        :param handler: server request handler
+        :param message: response (or encoded bytes if skip_encoding)
+        :param addr: remote address (udp) or None
+        :param skip_encoding: message is already encoded
+        """
+        if addr:
+            profile = self.profile(str(addr[0]), addr[1])
+        else:
+            profile = self.profile(handler.peer, handler.peer_port)
+        if not profile.active and not handler.send_lock.locked():
+            handler.server_send(message, addr, skip_encoding=skip_encoding)
+            return
+        if skip_encoding:
+            pdu = message
+        elif message.should_respond:
+            pdu = handler.framer.buildPacket(message)
+        else:
+            return
+        if profile.drop_rate and self.random.random() < profile.drop_rate:
+            Log.debug("Fault injection: dropping response {}", pdu, ":hex")
+            self.dropped += 1
+            return
+        if pdu and profile.corrupt_rate and self.random.random() < profile.corrupt_rate:
+            data = bytearray(pdu)
+            data[self.random.randrange(len(data))] ^= 1 << self.random.randrange(8)
+            pdu = bytes(data)
+            self.corrupted += 1
+        if delay := profile.delay + profile.jitter * self.random.random():
+            self.delayed += 1
+            await asyncio.sleep(delay)
+        async with handler.send_lock:
+            if profile.split < 2 or len(pdu) < 2:
+                handler.server_send(pdu, addr, skip_encoding=True)
+                return
+            self.split += 1
+            count = min(profile.split, len(pdu))
+            for i in range(count):
+                if i:
+                    await asyncio.sleep(profile.split_gap)
+                fragment = pdu[i * len(pdu) // count : (i + 1) * len(pdu) // count]
+                handler.server_send(fragment, addr, skip_encoding=True)
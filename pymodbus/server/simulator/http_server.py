@@ -4,10 +4,14 @@ from __future__ import annotations
 import asyncio
 import contextlib
 import dataclasses
+import hashlib
 import importlib
 import json
 import os
-from time import sleep
+import sys
+from array import array
+from collections import OrderedDict, deque
+from collections.abc import Iterator
 from typing import TYPE_CHECKING
 
 
@@ -33,9 +37,14 @@ from pymodbus.server.async_io import (
     ModbusTlsServer,
     ModbusUdpServer,
 )
+from pymodbus.server.faults import ModbusFaultInjector, ModbusFaultProfile
 
 
 MAX_FILTER = 1000
+MAX_CALLS = 10000
+MAX_EXPORT = 65536
+MAX_SNAPSHOTS = 64
+EXPORT_CHUNK = 4096
 
 RESPONSE_INACTIVE = -1
 RESPONSE_NORMAL = 0
@@ -55,6 +64,107 @@ class CallTracer:
     data: bytes = b""
 
 
+class CallTraceBuffer:
+    """Fixed size ring buffer of call traces.
+
+    Each trace gets a sequence number (0, 1, ...), when the buffer is
+    full the oldest trace is dropped. Sequence numbers of the traces are
+    indexed per function code and per address, so clients can fetch
+    only traces newer than the last seen sequence number.
+    """
+
+    def __init__(self, size: int = MAX_CALLS):
+        """Initialize buffer.
+
+        :param size: max number of traces kept
+        """
+        self.size = size
+        self.entries: list[CallTracer | None] = [None] * size
+        self.next_seq = 0
+        self.start_seq = 0
+        self.by_fc: dict[int, deque[int]] = {}
+        self.by_address: dict[int, deque[int]] = {}
+
+    @property
+    def first_seq(self) -> int:
+        """Return sequence number of oldest trace kept."""
+        return max(self.next_seq - self.size, self.start_seq)
+
+    def __len__(self) -> int:
+        """Return number of traces."""
+        return self.next_seq - self.first_seq
+
+    def __iter__(self):
+        """Iterate over traces, oldest first."""
+        for seq in range(self.first_seq, self.next_seq):
+            yield self.entries[seq % self.size]
+
+    def append(self, entry: CallTracer) -> int:
+        """Add trace, and return its sequence number.
+
+        :param entry: trace
+        """
+        seq = self.next_seq
+        if (old := self.entries[seq % self.size]) is not None:
+            self._unindex(self.by_fc, old.fc)
+            self._unindex(self.by_address, old.address)
+        self.entries[seq % self.size] = entry
+        self.by_fc.setdefault(entry.fc, deque()).append(seq)
+        self.by_address.setdefault(entry.address, deque()).append(seq)
+        self.next_seq += 1
+        return seq
+
+    @staticmethod
+    def _unindex(index: dict[int, deque[int]], key: int) -> None:
+        """Remove oldest sequence number of key (it is the oldest trace)."""
+        seqs = index[key]
+        seqs.popleft()
+        if not seqs:
+            del index[key]
+
+    def clear(self) -> None:
+        """Remove all traces, sequence numbers are not reused."""
+        self.entries = [None] * self.size
+        self.by_fc.clear()
+        self.by_address.clear()
+        self.start_seq = self.next_seq
+
+    def since(
+        self, seq: int, fc: int = -1, address: int = -1, limit: int = 0
+    ) -> list[tuple[int, CallTracer]]:
+        """Return (sequence number, trace) of traces with seq or newer, oldest first.
+
+        :param seq: first sequence number wanted
+        :param fc: only traces with function code (-1 for all)
+        :param address: only traces with address (-1 for all)
+        :param limit: return only the oldest limit traces (0 for all)
+        """
+        seq = max(seq, self.first_seq)
+        if fc == -1 and address == -1:
+            seqs = range(seq, self.next_seq)
+        else:
+            candidates = [
+                index.get(key, ())
+                for index, key in ((self.by_fc, fc), (self.by_address, address))
+                if key != -1
+            ]
+            found: list[int] = []
+            for inx in reversed(min(candidates, key=len)):
+                if inx < seq:
+                    break
+                found.append(inx)
+            seqs = reversed(found)  # type: ignore[assignment]
+        result = []
+        for inx in seqs:
+            entry = self.entries[inx % self.size]
+            if entry is None or fc not in (-1, entry.fc) or address not in (-1, entry.address):
+                continue
+            result.append((inx, entry))
+            if len(result) == limit:
+                break
+        return result
+
+
 @dataclasses.dataclass()
 class CallTypeMonitor:
     """Define Request/Response monitor."""
@@ -98,6 +208,9 @@ class ModbusSimulatorServer:
     - **"<addr>/api/log"** log handling, HTML with GET, REST-API with post
     - **"<addr>/api/registers"** register handling, HTML with GET, REST-API with post
     - **"<addr>/api/calls"** call (function code / message) handling, HTML with GET, REST-API with post
+    - **"<addr>/api/calls/json"** call traces as json, GET with since=<sequence number>
+    - **"<addr>/api/registers/export"** register values (json/binary), streamed GET
+    - **"<addr>/api/registers/bulk"** write many register values, POST with json
     - **"<addr>/api/server"** server handling, HTML with GET, REST-API with post
 
     Example::
@@ -162,6 +275,8 @@ class ModbusSimulatorServer:
                 info_name=server["identity"]
             )
         self.modbus_server = comm(framer=framer, context=datastore, **server)
+        self.fault_injector = ModbusFaultInjector()
+        self.modbus_server.fault_injector = self.fault_injector
         self.serving: asyncio.Future = asyncio.Future()
         self.log_file = log_file
         self.site: web.TCPSite | None = None
@@ -172,6 +287,9 @@ class ModbusSimulatorServer:
         self.web_app = web.Application()
         self.web_app.add_routes(
             [
+                web.get("/api/calls/json", self.handle_json_calls),
+                web.get("/api/registers/export", self.handle_registers_export),
+                web.post("/api/registers/bulk", self.handle_registers_bulk),
                 web.get("/api/{tail:[a-z]*}", self.handle_html),
                 web.post("/api/{tail:[a-z]*}", self.handle_json),
                 web.get("/{tail:[a-z0-9.]*}", self.handle_html_static),
@@ -207,7 +325,8 @@ class ModbusSimulatorServer:
                 self.generator_html[entry][0] = handle.read()
         self.refresh_rate = 0
         self.register_filter: list[int] = []
-        self.call_list: list[CallTracer] = []
+        self.call_list = CallTraceBuffer()
+        self.register_snapshots: OrderedDict[str, tuple[int, bytes]] = OrderedDict()
         self.request_lookup = ServerDecoder.getFCdict()
         self.call_monitor = CallTypeMonitor()
         self.call_response = CallTypeResponse()
@@ -222,6 +341,8 @@ class ModbusSimulatorServer:
                 self.modbus_server.serve_forever()
             )
             app[self.api_key].set_name("simulator modbus server")
+            if self.datastore_context.action_interval:
+                self.datastore_context.start_actions()
         except Exception as exc:
             Log.error("Error starting modbus server, reason: {}", exc)
             raise exc
@@ -232,6 +353,7 @@ class ModbusSimulatorServer:
     async def stop_modbus_server(self, app):
         """Stop modbus server."""
         Log.info("Stopping modbus server")
+        self.datastore_context.stop_actions()
         await self.modbus_server.shutdown()
         app[self.api_key].cancel()
         with contextlib.suppress(asyncio.exceptions.CancelledError):
@@ -299,6 +421,204 @@ class ModbusSimulatorServer:
         result = self.generator_json[page_type][1](params, json_dict)
         return web.Response(text=f"json build: {page_type} - {params} - {result}")
 
+    async def handle_json_calls(self, request):
+        """Handle api calls/json (traces newer than since=)."""
+        return web.json_response(self.build_json_calls_since(dict(request.query)))
+
+    def build_json_calls_since(self, params: dict) -> dict:
+        """Build json of call traces.
+
+        params (all optional): since (sequence number, default 0),
+        function, address (filter) and limit (max traces returned).
+        Fetch the next traces with since=<next> from the result.
+        """
+        try:
+            since = int(params.get("since", 0))
+            fc = int(params.get("function", -1))
+            address = int(params.get("address", -1))
+            limit = int(params.get("limit", 0))
+        except ValueError as exc:
+            raise web.HTTPBadRequest(reason=str(exc)) from exc
+        calls = self.call_list.since(since, fc=fc, address=address, limit=limit)
+        return {
+            "first": self.call_list.first_seq,
+            "next": calls[-1][0] + 1 if limit and len(calls) == limit else self.call_list.next_seq,
+            "calls": [
+                {
+                    "seq": seq,
+                    "call": entry.call,
+                    "fc": entry.fc,
+                    "address": entry.address,
+                    "count": entry.count,
+                    "data": entry.data.hex(),
+                }
+                for seq, entry in calls
+            ],
+        }
+
+    async def handle_registers_export(self, request):
+        """Handle api registers/export (streamed)."""
+        try:
+            etag, content_type, headers, chunks = self.build_registers_export(
+                dict(request.query)
+            )
+        except ValueError as exc:
+            raise web.HTTPBadRequest(reason=str(exc)) from exc
+        headers["ETag"] = f'"{etag}"'
+        if request.headers.get("If-None-Match") == headers["ETag"]:
+            return web.Response(status=304, headers={"ETag": headers["ETag"]})
+        headers["Content-Type"] = content_type
+        response = web.StreamResponse(headers=headers)
+        await response.prepare(request)
+        for chunk in chunks:
+            await response.write(chunk)
+        await response.write_eof()
+        return response
+
+    async def handle_registers_bulk(self, request):
+        """Handle api registers/bulk."""
+        try:
+            result = self.registers_bulk_write(await request.json())
+        except (ValueError, TypeError, KeyError, OverflowError) as exc:
+            raise web.HTTPBadRequest(reason=str(exc)) from exc
+        return web.json_response(result)
+
+    def registers_snapshot(self, start: int, stop: int) -> tuple[str, bytes]:
+        """Return (etag, copy) of register values start-stop.
+
+        Only the exported range is copied and hashed, the etag includes start.
+        The latest MAX_SNAPSHOTS copies are kept, to answer changed_since=<etag>.
+        """
+        data = self.datastore_context.registers.values[start:stop].tobytes()
+        digest = hashlib.blake2b(start.to_bytes(4, "big"), digest_size=8)
+        digest.update(data)
+        etag = digest.hexdigest()
+        self.register_snapshots[etag] = (start, data)
+        self.register_snapshots.move_to_end(etag)
+        while len(self.register_snapshots) > MAX_SNAPSHOTS:
+            self.register_snapshots.popitem(last=False)
+        return etag, data
+
+    def build_registers_export(
+        self, params: dict
+    ) -> tuple[str, str, dict[str, str], Iterator[bytes]]:
+        """Build export of register values.
+
+        params (all optional):
+
+        - start: first register (default 0)
+        - count: number of registers (default all, max MAX_EXPORT per call)
+        - format: "json" (default) or "binary"
+        - changed_since: etag of an earlier export, only changed registers are returned
+
+        json returns {"start", "count", "next", "etag", "values": [...]}, or
+        with changed_since {..., "base", "changes": [[register, value], ...]}.
+        binary returns the values as big endian uint16, or with changed_since
+        (register uint32, value uint16) pairs, "next" is in the X-Next-Start header.
+        When the changed_since snapshot is no longer kept, or does not cover
+        the exported range, all values are returned.
+
+        The values are streamed from the snapshot the etag is computed from.
+
+        Returns (etag, content type, headers, chunks).
+        """
+        cells = self.datastore_context.registers
+        start = int(params.get("start", 0))
+        count = int(params.get("count", min(len(cells) - start, MAX_EXPORT)))
+        if start < 0 or count < 0 or start + count > len(cells) or count > MAX_EXPORT:
+            raise ValueError(f"range {start}+{count} not in 0-{len(cells)}, max {MAX_EXPORT}")
+        if (export_format := params.get("format", "json")) not in ("json", "binary"):
+            raise ValueError(f"unknown format {export_format}")
+        stop = start + count
+        base = None
+        # look up the base first, storing the new snapshot may evict it.
+        if snapshot := self.register_snapshots.get(params.get("changed_since", "")):
+            base_start, base_data = snapshot
+            if base_start <= start and stop <= base_start + len(base_data) // 2:
+                base = memoryview(base_data).cast("H")[start - base_start : stop - base_start]
+        etag, data = self.registers_snapshot(start, stop)
+        new = memoryview(data).cast("H")
+        headers = {"X-Next-Start": str(stop if stop < len(cells) else -1)}
+        if export_format == "binary":
+            content_type = "application/octet-stream"
+            chunks = (
+                self._export_changes_binary(base, new, start)
+                if base is not None
+                else self._export_values_binary(new)
+            )
+            return etag, content_type, headers, chunks
+        head = {
+            "start": start,
+            "count": count,
+            "next": int(headers["X-Next-Start"]),
+            "etag": etag,
+        }
+        if base is not None:
+            head["base"] = params["changed_since"]
+        return etag, "application/json", headers, self._export_json(head, base, new, start)
+
+    @staticmethod
+    def _export_values_binary(new):
+        """Return values as big endian uint16 chunks."""
+        for inx in range(0, len(new), EXPORT_CHUNK):
+            chunk = array("H", new[inx : inx + EXPORT_CHUNK].tobytes())
+            if sys.byteorder == "little":
+                chunk.byteswap()
+            yield chunk.tobytes()
+
+    def _export_changes_binary(self, base, new, start):
+        """Return changes as big endian (uint32 register, uint16 value) chunks."""
+        for changes in self._changed_registers(base, new, start):
+            yield b"".join(
+                inx.to_bytes(4, "big") + value.to_bytes(2, "big") for inx, value in changes
+            )
+
+    def _export_json(self, head, base, new, start):
+        """Return json chunks."""
+        yield json.dumps(head)[:-1].encode()
+        first = True
+        if base is None:
+            yield b', "values": ['
+            for inx in range(0, len(new), EXPORT_CHUNK):
+                text = ", ".join(map(str, new[inx : inx + EXPORT_CHUNK]))
+                yield (text if first else ", " + text).encode()
+                first = False
+        else:
+            yield b', "changes": ['
+            for changes in self._changed_registers(base, new, start):
+                text = ", ".join(f"[{inx}, {value}]" for inx, value in changes)
+                yield (text if first else ", " + text).encode()
+                first = False
+        yield b"]}"
+
+    @staticmethod
+    def _changed_registers(old, new, start):
+        """Return lists of (register, value) that differ between two snapshots of a range."""
+        for inx in range(0, len(new), EXPORT_CHUNK):
+            end = min(inx + EXPORT_CHUNK, len(new))
+            if old[inx:end] == new[inx:end]:
+                continue
+            yield [(start + i, new[i]) for i in range(inx, end) if old[i] != new[i]]
+
+    def registers_bulk_write(self, body: dict) -> dict:
+        """Write register values.
+
+        body: {"writes": [{"register": <first register>, "values": [...]}, ...]}
+
+        All writes are validated before any value is written.
+        """
+        cells = self.datastore_context.registers
+        writes = []
+        for entry in body["writes"]:
+            register = int(entry["register"])
+            values = array("H", [int(value) for value in entry["values"]])
+            if register < 0 or register + len(values) > len(cells):
+                raise ValueError(f"register {register}+{len(values)} not in 0-{len(cells)}")
+            writes.append((register, values))
+        for register, values in writes:
+            cells.values[register : register + len(values)] = values
+        return {"written": sum(len(values) for _, values in writes)}
+
     def build_html_registers(self, params, html):
         """Build html registers page."""
         result_txt, foot = self.helper_build_html_submit(params)
@@ -388,14 +708,14 @@ class ModbusSimulatorServer:
             "ACTIVE" if self.call_response.active != RESPONSE_INACTIVE else ""
         )
 
-        max_len = MAX_FILTER if self.call_monitor.active else 0
-        while len(self.call_list) > max_len:
-            del self.call_list[0]
-        call_rows = ""
-        for entry in reversed(self.call_list):
-            # req_obj = self.request_lookup[entry[1]]
-            call_rows += f"<tr><td>{entry.call} - {entry.fc}</td><td>{entry.address}</td><td>{entry.count}</td><td>{entry.data.decode()}</td></tr>"
-            # line += req_obj.funcion_code_name
+        if not self.call_monitor.active and len(self.call_list):
+            self.call_list.clear()
+        call_rows = "".join(
+            f"<tr><td>{entry.call} - {entry.fc}</td><td>{entry.address}</td><td>{entry.count}</td><td>{entry.data.decode()}</td></tr>"
+            for _seq, entry in reversed(
+                self.call_list.since(self.call_list.next_seq - MAX_FILTER)
+            )
+        )
         new_html = (
             html.replace("<!--SIMULATION_ACTIVE-->", simulation_action)
             .replace("FUNCTION_RANGE_START", range_start_html)
@@ -498,6 +818,7 @@ class ModbusSimulatorServer:
     def action_reset(self, _params, _range_start, _range_stop):
         """Reset call simulation."""
         self.call_response = CallTypeResponse()
+        self.fault_injector.default = ModbusFaultProfile()
         if not self.call_monitor.active:
             self.modbus_server.response_manipulator = self.server_response_manipulator
         return None, None
@@ -608,24 +929,27 @@ class ModbusSimulatorServer:
             self.call_list.append(tracer)
             self.call_monitor.trace_response = False
 
-        if self.call_response.active != RESPONSE_INACTIVE:
+        if self.call_response.active == RESPONSE_INACTIVE:
+            return response, False
+        if self.call_response.clear_after <= 0:
+            Log.info("Resetting manipulator due to clear_after")
+            self.action_reset(None, -1, -1)
             return response, False
 
         skip_encoding = False
+        self.fault_injector.default = ModbusFaultProfile()
         if self.call_response.active == RESPONSE_EMPTY:
             Log.warning("Sending empty response")
             response.should_respond = False
         elif self.call_response.active == RESPONSE_NORMAL:
-            if self.call_response.delay:
-                Log.warning(
-                    "Delaying response by {}s for all incoming requests",
-                    self.call_response.delay,
-                )
-                sleep(self.call_response.delay)  # change to async
-            else:
-                pass
-                # self.call_response.change_rate
-                # self.call_response.split
+            # delay/split/change rate are done by the fault injector on the
+            # send path, so other connections are not blocked.
+            self.fault_injector.default = ModbusFaultProfile(
+                delay=self.call_response.delay,
+                split=2 if self.call_response.split else 0,
+                split_gap=self.call_response.split,
+                corrupt_rate=self.call_response.change_rate / 100,
+            )
         elif self.call_response.active == RESPONSE_ERROR:
             Log.warning("Sending error response for all incoming requests")
             err_response = ExceptionResponse(
@@ -633,14 +957,12 @@ class ModbusSimulatorServer:
             )
             err_response.transaction_id = response.transaction_id
             err_response.slave_id = response.slave_id
+            response = err_response
         elif self.call_response.active == RESPONSE_JUNK:
             response = os.urandom(self.call_response.junk_len)
             skip_encoding = True
 
         self.call_response.clear_after -= 1
-        if self.call_response.clear_after <= 0:
-            Log.info("Resetting manipulator due to clear_after")
-            self.call_response.active = RESPONSE_EMPTY
         return response, skip_encoding
 
     def server_request_tracer(self, request, *_addr):
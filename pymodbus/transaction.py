@@ -27,7 +27,7 @@ from pymodbus.framer import (
     ModbusTlsFramer,
 )
 from pymodbus.logging import Log
-from pymodbus.utilities import ModbusTransactionState, hexlify_packets
+from pymodbus.utilities import ModbusTransactionState
 
 
 # --------------------------------------------------------------------------- #
@@ -133,17 +133,18 @@ class ModbusTransactionManager:
         """Start the producer to send the next request to consumer.write(Frame(request))."""
         with self._transaction_lock:
             try:
-                Log.debug(
-                    "Current transaction state - {}",
-                    ModbusTransactionState.to_string(self.client.state),
-                )
+                if Log.hot_path:
+                    Log.debug(
+                        "Current transaction state - {}",
+                        self.client.state,
+                        ":state",
+                    )
                 retries = self.retries
                 request.transaction_id = self.getNextTID()
-                Log.debug("Running transaction {}", request.transaction_id)
-                if _buffer := hexlify_packets(
-                    self.client.framer._buffer  # pylint: disable=protected-access
-                ):
-                    Log.debug("Clearing current Frame: - {}", _buffer)
+                if Log.hot_path:
+                    Log.debug("Running transaction {}", request.transaction_id)
+                if _buffer := self.client.framer._buffer:  # pylint: disable=protected-access
+                    Log.debug("Clearing current Frame: - {}", _buffer, ":hex")
                     self.client.framer.resetFrame()
                 if broadcast := (
                     self.client.params.broadcast_enable and not request.slave_id
@@ -220,7 +221,7 @@ class ModbusTransactionManager:
                         else:
                             break
                         # full = False
-                        Log.debug("Retry getting response: - {}", _buffer)
+                        Log.debug("Retry getting response: - {}", _buffer, ":hex")
                     addTransaction = partial(  # pylint: disable=invalid-name
                         self.addTransaction,
                         tid=request.transaction_id,
@@ -292,7 +293,8 @@ class ModbusTransactionManager:
         try:
             self.client.connect()
             packet = self.client.framer.buildPacket(packet)
-            Log.debug("SEND: {}", packet, ":hex")
+            if Log.hot_path:
+                Log.debug("SEND: {}", packet, ":hex")
             size = self._send(packet)
             if (
                 isinstance(size, bytes)
@@ -309,21 +311,24 @@ class ModbusTransactionManager:
                     return b"", "Wrong local echo"
             if broadcast:
                 if size:
-                    Log.debug(
-                        'Changing transaction state from "SENDING" '
-                        'to "TRANSACTION_COMPLETE"'
-                    )
+                    if Log.hot_path:
+                        Log.debug(
+                            'Changing transaction state from "SENDING" '
+                            'to "TRANSACTION_COMPLETE"'
+                        )
                     self.client.state = ModbusTransactionState.TRANSACTION_COMPLETE
                 return b"", None
             if size:
-                Log.debug(
-                    'Changing transaction state from "SENDING" '
-                    'to "WAITING FOR REPLY"'
-                )
+                if Log.hot_path:
+                    Log.debug(
+                        'Changing transaction state from "SENDING" '
+                        'to "WAITING FOR REPLY"'
+                    )
                 self.client.state = ModbusTransactionState.WAITING_FOR_REPLY
             result = self._recv(response_length, full)
             # result2 = self._recv(response_length, full)
-            Log.debug("RECV: {}", result, ":hex")
+            if Log.hot_path:
+                Log.debug("RECV: {}", result, ":hex")
         except (OSError, ModbusIOException, InvalidMessageReceivedException, ConnectionException) as msg:
             self.client.close()
             Log.debug("Transaction failed. ({}) ", msg)
@@ -412,10 +417,11 @@ class ModbusTransactionManager:
             # should be triggered, so total must be None here
             Log.debug("No response received to unbounded read !!!!")
         if self.client.state != ModbusTransactionState.PROCESSING_REPLY:
-            Log.debug(
-                "Changing transaction state from "
-                '"WAITING FOR REPLY" to "PROCESSING REPLY"'
-            )
+            if Log.hot_path:
+                Log.debug(
+                    "Changing transaction state from "
+                    '"WAITING FOR REPLY" to "PROCESSING REPLY"'
+                )
             self.client.state = ModbusTransactionState.PROCESSING_REPLY
         return result
 
@@ -440,7 +446,8 @@ class ModbusTransactionManager:
         :param tid: The overloaded transaction id to use
         """
         tid = tid if tid is not None else request.transaction_id
-        Log.debug("Adding transaction {}", tid)
+        if Log.hot_path:
+            Log.debug("Adding transaction {}", tid)
         self.transactions[tid] = request
 
     def getTransaction(self, tid):
@@ -451,7 +458,8 @@ class ModbusTransactionManager:
         :param tid: The transaction to retrieve
 
         """
-        Log.debug("Getting transaction {}", tid)
+        if Log.hot_path:
+            Log.debug("Getting transaction {}", tid)
         if not tid:
             if self.transactions:
                 ret = self.transactions.popitem()[1]
@@ -465,7 +473,8 @@ class ModbusTransactionManager:
 
         :param tid: The transaction to remove
         """
-        Log.debug("deleting transaction {}", tid)
+        if Log.hot_path:
+            Log.debug("deleting transaction {}", tid)
         self.transactions.pop(tid, None)
 
     def getNextTID(self):
@@ -4,16 +4,43 @@ from __future__ import annotations
 import asyncio
 import contextlib
 import os
+import threading
 
 
 with contextlib.suppress(ImportError):
     import serial
 
 
+def serial_timing(
+    baudrate: int = 9600, bytesize: int = 8, parity: str = "N", stopbits: float = 1
+) -> tuple[float, float, float]:
+    """Return (char time, t1.5, t3.5) of a serial line.
+
+    A character is start bit, data bits, parity bit (unless parity is
+    "N") and stop bits. Above 19200 baud t1.5 and t3.5 are fixed at
+    0.75 ms and 1.75 ms, as recommended by the modbus serial line
+    specification.
+    """
+    char_time = float(1 + bytesize + (parity != "N") + stopbits) / baudrate
+    if baudrate > 19200:
+        return char_time, 0.00075, 0.00175
+    return char_time, 1.5 * char_time, 3.5 * char_time
+
+
 class SerialTransport(asyncio.Transport):
-    """An asyncio serial transport."""
+    """An asyncio serial transport.
 
-    force_poll: bool = os.name == "nt"
+    Data is received in one of 3 ways:
+
+    - the event loop monitors the file descriptor (default on posix),
+    - a reader thread blocks in read() and delivers complete frames,
+      detected by the inter character gap (default on windows, where
+      the event loop cannot monitor serial ports),
+    - polling (force_poll), kept only as fallback.
+    """
+
+    force_poll: bool = False
+    force_thread: bool = os.name == "nt"
 
     def __init__(self, loop, protocol, *args, **kwargs) -> None:
         """Initialize."""
@@ -23,7 +50,14 @@ class SerialTransport(asyncio.Transport):
         self.sync_serial = serial.serial_for_url(*args, **kwargs)
         self.intern_write_buffer: list[bytes] = []
         self.poll_task: asyncio.Task | None = None
+        self.reader_thread: threading.Thread | None = None
         self._poll_wait_time = 0.0005
+        _char_time, _t1_5, self.frame_gap = serial_timing(
+            kwargs.get("baudrate", 9600),
+            kwargs.get("bytesize", 8),
+            kwargs.get("parity", "N"),
+            kwargs.get("stopbits", 1),
+        )
         self.sync_serial.timeout = 0
         self.sync_serial.write_timeout = 0
 
@@ -32,6 +66,17 @@ class SerialTransport(asyncio.Transport):
         if self.force_poll:
             self.poll_task = asyncio.create_task(self.polling_task())
             self.poll_task.set_name("SerialTransport poll")
+        elif self.force_thread:
+            # read() returns when the line has been silent for frame_gap,
+            # or after timeout (to check for close).
+            self.sync_serial.timeout = 0.1
+            self.sync_serial.inter_byte_timeout = self.frame_gap
+            self.reader_thread = threading.Thread(
+                target=self.intern_reader_thread,
+                name="SerialTransport reader",
+                daemon=True,
+            )
+            self.reader_thread.start()
         else:
             self.async_loop.add_reader(self.sync_serial.fileno(), self.intern_read_ready)
         self.async_loop.call_soon(self.intern_protocol.connection_made, self)
@@ -44,6 +89,10 @@ class SerialTransport(asyncio.Transport):
         if self.poll_task:
             self.poll_task.cancel()
             self.poll_task = None
+        elif self.reader_thread:
+            self.reader_thread = None
+            with contextlib.suppress(Exception):
+                self.sync_serial.cancel_read()
         else:
             self.async_loop.remove_reader(self.sync_serial.fileno())
             self.async_loop.remove_writer(self.sync_serial.fileno())
@@ -56,12 +105,14 @@ class SerialTransport(asyncio.Transport):
     def write(self, data) -> None:
         """Write some data to the transport."""
         self.intern_write_buffer.append(data)
-        if not self.force_poll:
+        if self.reader_thread:
+            self.intern_write_ready()
+        elif not self.force_poll:
             self.async_loop.add_writer(self.sync_serial.fileno(), self.intern_write_ready)
 
     def flush(self) -> None:
         """Clear output buffer and stops any more data being written."""
-        if not self.poll_task:
+        if not (self.poll_task or self.reader_thread):
             self.async_loop.remove_writer(self.sync_serial.fileno())
         self.intern_write_buffer.clear()
 
@@ -133,17 +184,44 @@ class SerialTransport(asyncio.Transport):
         try:
             if (nlen := self.sync_serial.write(data)) and nlen < len(data):
                 self.intern_write_buffer = [data[nlen:]]
-                if not self.poll_task:
+                if self.reader_thread:
+                    self.async_loop.call_later(self.frame_gap, self.intern_write_ready)
+                elif not self.poll_task:
                     self.async_loop.add_writer(
                         self.sync_serial.fileno(), self.intern_write_ready
                     )
                 return
             self.flush()
         except (BlockingIOError, InterruptedError):
+            if self.reader_thread:
+                self.async_loop.call_later(self.frame_gap, self.intern_write_ready)
             return
         except serial.SerialException as exc:
             self.close(exc=exc)
 
+    def intern_reader_thread(self) -> None:
+        """Read frames in a thread, and deliver them to the event loop."""
+        sync_serial = self.sync_serial
+        while self.reader_thread:
+            try:
+                data = sync_serial.read(1024)
+            except Exception as exc:  # pylint: disable=broad-except
+                if self.reader_thread:
+                    self.async_loop.call_soon_threadsafe(self.intern_read_failed, exc)
+                return
+            if data and self.reader_thread:
+                self.async_loop.call_soon_threadsafe(self.intern_read_data, data)
+
+    def intern_read_data(self, data: bytes) -> None:
+        """Deliver data read by the reader thread."""
+        if self.sync_serial:
+            self.intern_protocol.data_received(data)  # type: ignore[attr-defined]
+
+    def intern_read_failed(self, exc: Exception) -> None:
+        """Close after reader thread failed."""
+        if self.sync_serial:
+            self.close(exc=exc)
+
     async def polling_task(self):
         """Poll and try to read/write."""
         while self.sync_serial:
@@ -88,6 +88,7 @@ class CommParams:
     port: int = 0
     source_address: tuple[str, int] | None = None
     handle_local_echo: bool = False
+    reuse_port: bool = False
 
     # tls
     sslctx: ssl.SSLContext | None = None
@@ -225,6 +226,7 @@ class ModbusProtocol(asyncio.BaseProtocol):
                 port,
                 ssl=self.comm_params.sslctx,
                 reuse_address=True,
+                reuse_port=self.comm_params.reuse_port or None,
                 start_serving=True,
             )
         else:
@@ -325,23 +327,26 @@ class ModbusProtocol(asyncio.BaseProtocol):
                 self.sent_buffer = b""
             if not data:
                 return
-        Log.debug(
-            "recv: {} old_data: {} addr={}",
-            data,
-            ":hex",
-            self.recv_buffer,
-            ":hex",
-            addr,
-        )
-        self.recv_buffer += data
-        cut = self.callback_data(self.recv_buffer, addr=addr)
-        self.recv_buffer = self.recv_buffer[cut:]
-        if self.recv_buffer:
+        if Log.hot_path:
             Log.debug(
-                "recv, unused data waiting for next packet: {}",
+                "recv: {} old_data: {} addr={}",
+                data,
+                ":hex",
                 self.recv_buffer,
                 ":hex",
+                addr,
             )
+        if self.recv_buffer:
+            data = self.recv_buffer + data
+        cut = self.callback_data(data, addr=addr)
+        self.recv_buffer = data[cut:]
+        if self.recv_buffer:
+            if Log.hot_path:
+                Log.debug(
+                    "recv, unused data waiting for next packet: {}",
+                    self.recv_buffer,
+                    ":hex",
+                )
 
     def eof_received(self) -> None:
         """Accept other end terminates connection."""
@@ -382,7 +387,8 @@ class ModbusProtocol(asyncio.BaseProtocol):
         if not self.transport:
             Log.error("Cancel send, because not connected!")
             return
-        Log.debug("send: {}", data, ":hex")
+        if Log.hot_path:
+            Log.debug("send: {}", data, ":hex")
         if self.comm_params.handle_local_echo:
             self.sent_buffer += data
         if self.comm_params.comm_type == CommType.UDP:
@@ -7,14 +7,21 @@ from __future__ import annotations
 
 
 __all__ = [
+    "PackedBits",
     "pack_bitstring",
     "unpack_bitstring",
+    "pack_registers",
+    "unpack_registers",
     "default",
     "rtuFrameSize",
 ]
 
 # pylint: disable=missing-type-doc
 import struct
+import sys
+from array import array
+from collections.abc import Sequence
+from itertools import chain
 
 
 class ModbusTransactionState:  # pylint: disable=too-few-public-methods
@@ -98,31 +105,110 @@ def dict_property(store, index):
 # --------------------------------------------------------------------------- #
 # Bit packing functions
 # --------------------------------------------------------------------------- #
-def pack_bitstring(bits: list[bool]) -> bytes:
+_BIT_CHARS = bytes.maketrans(b"\x00\x01", b"01")
+_UNPACK_BITS = [tuple(bool(i >> bit & 1) for bit in range(8)) for i in range(256)]
+
+
+class PackedBits(Sequence):
+    """Bits kept in modbus packed form (LSB of first byte is bit 0).
+
+    Behaves like a list of bools (index, slice, iterate, compare with a
+    list), but only converts the bits that are accessed, so reading a
+    few bits out of a 2000 bit response does not allocate 2000 bools.
+
+    example::
+
+        bits = PackedBits(b"\x05")
+        bits[0], bits[1], bits[2]  # True, False, True
+    """
+
+    __slots__ = ("_data", "_count")
+
+    def __init__(self, data: bytes = b"", count: int | None = None):
+        """Initialize a new instance.
+
+        :param data: The packed bytes
+        :param count: Number of valid bits (default all bits in data)
+        """
+        self._data = bytearray(data)
+        self._count = len(self._data) * 8 if count is None else count
+
+    def __len__(self):
+        """Return number of bits."""
+        return self._count
+
+    def __getitem__(self, index):
+        """Return bit (or list of bits for a slice)."""
+        if isinstance(index, slice):
+            return [self[i] for i in range(*index.indices(self._count))]
+        if index < 0:
+            index += self._count
+        if not 0 <= index < self._count:
+            raise IndexError("PackedBits index out of range")
+        return bool(self._data[index >> 3] >> (index & 7) & 1)
+
+    def __setitem__(self, index: int, value):
+        """Set bit."""
+        if index < 0:
+            index += self._count
+        if not 0 <= index < self._count:
+            raise IndexError("PackedBits index out of range")
+        if value:
+            self._data[index >> 3] |= 1 << (index & 7)
+        else:
+            self._data[index >> 3] &= ~(1 << (index & 7)) & 0xFF
+
+    def __iter__(self):
+        """Iterate over all bits."""
+        return iter(self.tolist())
+
+    def __eq__(self, other):
+        """Compare with another PackedBits or a sequence of bits."""
+        if isinstance(other, PackedBits):
+            return self._count == other._count and self.tobytes() == other.tobytes()
+        if isinstance(other, (list, tuple)):
+            return self.tolist() == [bool(bit) for bit in other]
+        return NotImplemented
+
+    def __repr__(self):
+        """Return a string representation of the instance."""
+        return f"PackedBits({self.tolist()})"
+
+    def tobytes(self) -> bytes:
+        """Return the packed bytes (unused high bits cleared)."""
+        data = bytes(self._data[: (self._count + 7) // 8])
+        if self._count & 7:
+            data = data[:-1] + bytes([data[-1] & ((1 << (self._count & 7)) - 1)])
+        return data
+
+    def tolist(self) -> list[bool]:
+        """Return all bits as a list of bools."""
+        return unpack_bitstring(self._data)[: self._count]
+
+
+def pack_bitstring(bits: list[bool] | PackedBits) -> bytes:
     """Create a bytestring out of a list of bits.
 
-    :param bits: A list of bits
+    :param bits: A list of bits (or PackedBits)
 
     example::
 
         bits   = [False, True, False, True]
         result = pack_bitstring(bits)
     """
-    ret = b""
-    i = packed = 0
-    for bit in bits:
-        if bit:
-            packed += 128
-        i += 1
-        if i == 8:
-            ret += struct.pack(">B", packed)
-            i = packed = 0
-        else:
-            packed >>= 1
-    if 0 < i < 8:
-        packed >>= 7 - i
-        ret += struct.pack(">B", packed)
-    return ret
+    if isinstance(bits, PackedBits):
+        return bits.tobytes()
+    if not (count := len(bits)):
+        return b""
+    try:
+        raw = bytes(bits)
+    except (TypeError, ValueError):
+        raw = b"\x02"
+    if raw.translate(None, b"\x00\x01"):
+        raw = bytes(map(bool, bits))
+    # bit 0 must end up as LSB, so reverse the "0"/"1" string and let int() pack it
+    value = int(raw.translate(_BIT_CHARS)[::-1], 2)
+    return value.to_bytes((count + 7) // 8, "little")
 
 
 def unpack_bitstring(data: bytes) -> list[bool]:
@@ -135,14 +221,53 @@ def unpack_bitstring(data: bytes) -> list[bool]:
         bytes  = "bytes to decode"
         result = unpack_bitstring(bytes)
     """
-    byte_count = len(data)
-    bits = []
-    for byte in range(byte_count):
-        value = int(int(data[byte]))
-        for _ in range(8):
-            bits.append((value & 1) == 1)
-            value >>= 1
-    return bits
+    return list(chain.from_iterable(map(_UNPACK_BITS.__getitem__, data)))
+
+
+def pack_registers(values: list[int] | array) -> bytes:
+    """Create a bytestring (big endian) out of a list of 16 bit registers.
+
+    :param values: list of registers (or array("H")/memoryview/numpy uint16 vector)
+
+    example::
+
+        result = pack_registers([0x0102, 0x0304])  # b"\x01\x02\x03\x04"
+    """
+    if not isinstance(values, list):
+        try:
+            view = memoryview(values)
+        except TypeError:
+            view = None
+        if view and view.format in ("H", "<H", "=H"):
+            packed = array("H")
+            packed.frombytes(view.tobytes())
+            if sys.byteorder == "little":
+                packed.byteswap()
+            return packed.tobytes()
+    return struct.pack(f">{len(values)}H", *values)
+
+
+def unpack_registers(data: bytes, as_array: bool = False) -> list[int] | array:
+    """Create a list of 16 bit registers out of a bytestring (big endian).
+
+    :param data: The modbus data packet to decode
+    :param as_array: return array("H") instead of a list
+    :raises struct.error: odd number of bytes (truncated frame)
+
+    example::
+
+        result = unpack_registers(b"\x01\x02\x03\x04")  # [0x0102, 0x0304]
+    """
+    if len(data) & 0x01:
+        raise struct.error(f"register data must be an even number of bytes, got {len(data)}")
+    count = len(data) // 2
+    if as_array:
+        values = array("H")
+        values.frombytes(data[: count * 2])
+        if sys.byteorder == "little":
+            values.byteswap()
+        return values
+    return list(struct.unpack_from(f">{count}H", data))
 
 
 # --------------------------------------------------------------------------- #
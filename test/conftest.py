@@ -46,6 +46,8 @@ BASE_PORTS = {
     "TestClientServerSyncExamples": 8300,
     "TestClientServerAsyncExamples": 8400,
     "TestNetwork": 8500,
+    "TestMetrics": 8600,
+    "TestServerFaults": 8700,
 }
 
 
@@ -27,6 +27,7 @@ class TestFramerAscii:
             (b'abc:00010001000AF4', 3, 0, b''), # garble before frame
             (b'abc00010001000AF4', 17, 0, b''), # only garble
             (b':01010001000A00\r\n', 17, 0, b''),
+            (b':' + b'0' * 600, 1, 0, b''), # no end within max frame size
         ],
     )
     def test_decode(self, frame, packet, used_len, res_id, res):
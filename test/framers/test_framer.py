@@ -133,6 +133,31 @@ class TestFramer:
         assert FramerRTU.compute_CRC(data) == 0xE2DB
         assert FramerRTU.check_CRC(data, 0xE2DB)
 
+    @pytest.mark.parametrize(
+        ("data", "crc"),
+        [(b'', 0xFFFF),
+         (b'\x12', 0x3F4D),
+         (b'\x12\x34\x23\x45\x34\x56\x45', 0x4223),
+         (b'\x12\x34\x23\x45\x34\x56\x45\x67', 0xE2DB),
+        ]
+    )
+    def test_CRC_buffers(self, data, crc):
+        """Test CRC with odd length and different buffer types."""
+        assert len(FramerRTU.generate_crc16_table_wide()) == 65536
+        for buf in (data, bytearray(data), memoryview(b'\x00' + data)[1:]):
+            assert FramerRTU.compute_CRC(buf) == crc
+        expect = 0xFFFF
+        for byte in data:
+            expect = (expect >> 8) ^ FramerRTU.crc16_table[(expect ^ byte) & 0xFF]
+        assert ((expect << 8) & 0xFF00) | (expect >> 8) == crc
+
+    def test_CRC_native(self):
+        """Test CRC using the optional C implementation."""
+        data = b'\x12\x34\x23\x45\x34\x56\x45\x67'
+        with mock.patch("pymodbus.framer.rtu.CRC16_NATIVE", return_value=0xDBE2) as native:
+            assert FramerRTU.compute_CRC(memoryview(data)) == 0xE2DB
+            native.assert_called_once_with(data)
+
 
 
 class TestFramer2:
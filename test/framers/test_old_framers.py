@@ -421,6 +421,38 @@ class TestFramers:
             framer.processIncomingPacket(part2, _handle_response, slave=0)
             assert response_ok, "Response is valid, but not accepted"
 
+    @pytest.mark.parametrize(
+        ("framer", "message"),
+        [
+            (ModbusAsciiFramer, b':01010001000AF3\r\n',),
+            (ModbusRtuFramer, b"\x01\x01\x03\x01\x00\n\xed\x89",),
+            (ModbusSocketFramer, b'\x00\x00\x00\x00\x00\x06\x01\x01\x00\x01\x00\n',),
+        ]
+    )
+    def test_recv_burst_packet(self, framer, message):
+        """Test receive many frames in one packet, followed by a partial frame."""
+        replies = []
+        test_framer = framer(ClientDecoder())
+        test_framer.processIncomingPacket(message * 100 + message[:5], replies.append, 1)
+        assert len(replies) == 100
+        assert test_framer._buffer == message[:5]  # pylint: disable=protected-access
+        test_framer.processIncomingPacket(message[5:], replies.append, 1)
+        assert len(replies) == 101
+        assert not test_framer._buffer  # pylint: disable=protected-access
+
+
+    def test_recv_rtu_noise(self):
+        """Test rtu frames are found in noise, received in small chunks."""
+        replies = []
+        message = b"\x11\x03\x06\xAE\x41\x56\x52\x43\x40\x49\xAD"
+        data = b"\x05\x11\x03\x06\xAE\x41\x00" + message + b"\x11\x03\x02\x00" + message
+        test_framer = ModbusRtuFramer(ClientDecoder())
+        for i in range(0, len(data), 3):
+            test_framer.processIncomingPacket(data[i : i + 3], replies.append, [17])
+        assert len(replies) == 2
+        assert replies[0].registers == [0xAE41, 0x5652, 0x4340]
+        assert not test_framer._buffer  # pylint: disable=protected-access
+        assert test_framer.message_handler.crc_errors == 2
 
     def test_recv_socket_exception_packet(self):
         """Test receive packet."""
@@ -11,7 +11,12 @@ class TestFramerRTU:
     @pytest.fixture(name="frame")
     def prepare_frame():
         """Return message object."""
-        return FramerRTU()
+        frame = FramerRTU()
+        frame.set_dev_ids([0])
+        frame.set_fc_calc(1, 0, 2)
+        frame.set_fc_calc(3, 0, 2)
+        frame.set_fc_calc(5, 8, 0)
+        return frame
 
 
     @pytest.mark.parametrize(
@@ -24,8 +29,69 @@ class TestFramerRTU:
     )
     def test_roundtrip(self, frame, data, dev_id, res_msg):
         """Test encode."""
-        # msg = frame.encode(data, dev_id, 0)
-        # res_len, _, res_id, res_data = frame.decode(msg)
-        # assert data == res_data
-        # assert dev_id == res_id
-        # assert res_len == len(res_msg)
+        msg = frame.encode(data, dev_id, 0)
+        assert msg == res_msg
+        res_len, _, res_id, res_data = frame.decode(msg)
+        assert data == res_data
+        assert dev_id == res_id
+        assert res_len == len(res_msg)
+
+    def test_hunt_split(self, frame):
+        """Test frame received byte by byte."""
+        msg = b'\x11\x03\x06\xAE\x41\x56\x52\x43\x40\x49\xAD'
+        for i in range(1, len(msg)):
+            assert frame.hunt_frame(msg[:i]) == (0, 0)
+            assert frame.pending == (i > 1)
+        assert frame.hunt_frame(msg) == (0, len(msg))
+
+    def test_hunt_resync(self, frame):
+        """Test garbage and bad crc frames are skipped."""
+        good = b'\x11\x03\x06\xAE\x41\x56\x52\x43\x40\x49\xAD'
+        data = b'\x99\x11\x03\x06\xAE\x41\x56\x52\x43\x40\x49\xAC' + good
+        assert frame.decode(data) == (12 + len(good), 0, 0x11, good[1:-2])
+        assert frame.crc_errors == 1
+        assert not frame.pending
+        assert frame.decode(b'\x99\x98\x97') == (2, 0, 0, b'')
+        frame.reset()
+        assert frame.hunt_frame(b'\x11\x05\x00') == (0, 0)
+
+    def test_hunt_scan_once(self, frame):
+        """Test each byte is checked once as frame start, when data is added."""
+
+        class CountIds(list):
+            """Count lookups."""
+
+            lookups = 0
+
+            def __contains__(self, value):
+                """Count lookups."""
+                CountIds.lookups += 1
+                return super().__contains__(value)
+
+        frame.set_dev_ids(CountIds([0x11]))
+        CountIds.lookups = 0
+        noise = bytes((i * 37 + 11) % 256 for i in range(997))
+        data = b''
+        for i in range(0, len(noise), 7):
+            data += noise[i : i + 7]
+            keep, end = frame.hunt_frame(data)
+            assert not end
+            data = data[keep:]
+            frame.consume(keep)
+        assert CountIds.lookups == len(noise) - 1
+
+    def test_hunt_noise(self, frame):
+        """Test noise does not keep candidates (and buffer) alive."""
+        assert frame.frame_size(b'\x11\x03\xfb') == 256
+        assert frame.frame_size(b'\x11\x03\xfc') == -1
+        frame.frame_size = lambda data: 0  # custom pdu, size never known
+        noise = bytes((i * 37 + 11) % 256 for i in range(5000))
+        data = b''
+        for i in range(0, len(noise), 3):
+            data += noise[i : i + 3]
+            keep, end = frame.hunt_frame(data)
+            assert not end
+            data = data[keep:]
+            frame.consume(keep)
+            assert len(data) <= frame.MAX_SIZE + 3
+            assert len(frame._candidates) <= frame.MAX_SIZE  # pylint: disable=protected-access
@@ -18,9 +18,13 @@ from examples.helper import get_certificate
 from pymodbus import FramerType
 from pymodbus.client.base import ModbusBaseClient
 from pymodbus.client.mixin import ModbusClientMixin
+from pymodbus.client.serial import ModbusBusMaster, ModbusBusTiming
 from pymodbus.datastore import ModbusSlaveContext
 from pymodbus.datastore.store import ModbusSequentialDataBlock
 from pymodbus.exceptions import ConnectionException, ModbusException, ModbusIOException
+from pymodbus.factory import ServerDecoder
+from pymodbus.framer import ModbusSocketFramer
+from pymodbus.metrics import ModbusMetrics
 from pymodbus.pdu import ModbusRequest
 from pymodbus.transport import CommType
 
@@ -457,6 +461,235 @@ async def test_client_protocol_timeout():
     assert transport.retries == 1
 
 
+async def test_client_protocol_inflight():
+    """Test the client protocol execute method with pipelined requests."""
+    base = ModbusBaseClient(FramerType.SOCKET, host="127.0.0.1", max_inflight=5)
+    assert base.max_inflight == 5
+    sent = []
+
+    class PipeTransport:
+        """Collect requests, respond in reverse order."""
+
+        def write(self, data, addr=None):
+            """Write data."""
+            sent.append(data)
+
+        def close(self):
+            """Close the transport."""
+
+    base.ctx.connection_made(transport=PipeTransport())
+    requests = [pdu_bit_read.ReadCoilsRequest(i, 1, slave=1) for i in range(5)]
+    tasks = [asyncio.create_task(base.async_execute(rq)) for rq in requests]
+    await asyncio.sleep(0.05)
+    assert len(sent) == 5
+    db = ModbusSequentialDataBlock(1, [0, 1, 0, 1, 0])
+    ctx = ModbusSlaveContext(di=db, co=db, hr=db, ir=db)
+    for rq in reversed(requests):
+        resp = await rq.execute(ctx)
+        resp.transaction_id = rq.transaction_id
+        base.ctx.data_received(base.ctx.framer.buildPacket(resp))
+    for rq, task in zip(requests, tasks):
+        assert (await task).bits[0] == bool(rq.address % 2)
+    assert not list(base.ctx.transaction)
+
+
+async def test_client_protocol_inflight_timeout():
+    """Test a pipelined request without response only fails itself."""
+    base = ModbusBaseClient(
+        FramerType.SOCKET, host="127.0.0.1", max_inflight=3, timeout=0.2, retries=0
+    )
+    base.ctx.connection_lost = mock.MagicMock()
+    sent = []
+
+    class PipeTransport:
+        """Collect requests."""
+
+        def write(self, data, addr=None):
+            """Write data."""
+            sent.append(data)
+
+        def close(self):
+            """Close the transport."""
+
+    base.ctx.connection_made(transport=PipeTransport())
+    requests = [pdu_bit_read.ReadCoilsRequest(i, 1, slave=1) for i in range(3)]
+    tasks = [asyncio.create_task(base.async_execute(rq)) for rq in requests]
+    await asyncio.sleep(0.05)
+    assert len(sent) == 3
+    db = ModbusSequentialDataBlock(1, [0, 1, 0])
+    ctx = ModbusSlaveContext(di=db, co=db, hr=db, ir=db)
+    for rq in requests[1:]:
+        resp = await rq.execute(ctx)
+        resp.transaction_id = rq.transaction_id
+        base.ctx.data_received(base.ctx.framer.buildPacket(resp))
+    assert (await tasks[1]).bits[0]
+    assert not (await tasks[2]).bits[0]
+    with pytest.raises(ModbusIOException):
+        await tasks[0]
+    base.ctx.connection_lost.assert_not_called()
+
+    # no response at all, the connection is closed.
+    tasks = [asyncio.create_task(base.async_execute(rq)) for rq in requests]
+    for task in tasks:
+        with pytest.raises(ModbusIOException):
+            await task
+    base.ctx.connection_lost.assert_called()
+
+
+async def test_client_protocol_inflight_rtu():
+    """Test max_inflight is not used without transaction id."""
+    base = ModbusBaseClient(FramerType.RTU, max_inflight=5)
+    assert base.max_inflight == 1
+
+
+def test_client_bus_timing():
+    """Test serial bus timing values."""
+    timing = ModbusBusTiming(9600, 8, "E", 1)
+    assert timing.char_time == 11 / 9600
+    assert timing.t3_5 == 3.5 * 11 / 9600
+    assert timing.frame_gap == timing.t3_5
+    timing = ModbusBusTiming(115200, frame_gap=0.01)
+    assert (timing.t1_5, timing.t3_5, timing.frame_gap) == (0.00075, 0.00175, 0.01)
+
+
+async def test_client_protocol_bus_timing():
+    """Test inter-frame gap before send, and partial frame discard."""
+    base = ModbusBaseClient(FramerType.RTU)
+    base.ctx.bus_timing = ModbusBusTiming(1200, frame_gap=0.05)
+    base.ctx.bus_timing.on_frame_end = base.ctx.callback_frame_end
+    loop = asyncio.get_running_loop()
+    request = pdu_bit_read.ReadCoilsRequest(1, 1, slave=1)
+    transport = MockTransport(base, request)
+    sent = []
+    write = transport.write
+    transport.write = lambda data, addr=None: sent.append(loop.time()) or write(data)
+    base.ctx.connection_made(transport=transport)
+
+    base.ctx.data_received(b"\x01\x01")
+    assert base.ctx.framer._buffer  # pylint: disable=protected-access
+    await asyncio.sleep(0.1)
+    assert not base.ctx.framer._buffer  # pylint: disable=protected-access
+    assert not (await base.async_execute(request)).isError()
+    rx_end = base.ctx.bus_timing.last_rx
+    assert not (await base.async_execute(request)).isError()
+    assert sent[1] - rx_end >= base.ctx.bus_timing.t3_5
+    base.ctx.connection_lost(None)
+    assert not base.ctx.bus_timing._timer  # pylint: disable=protected-access
+
+
+async def test_serial_client_bus_timing():
+    """Test async serial client creates bus timing."""
+    assert not lib_client.AsyncModbusSerialClient("/dev/null").ctx.bus_timing
+    client = lib_client.AsyncModbusSerialClient(
+        "/dev/null", baudrate=115200, bus_timing=True
+    )
+    assert client.ctx.bus_timing.t3_5 == 0.00175
+    assert not client.ctx.bus_timing.on_frame_end
+    client = lib_client.AsyncModbusSerialClient("/dev/null", frame_gap=0.01)
+    assert client.ctx.bus_timing.frame_gap == 0.01
+    assert client.ctx.bus_timing.on_frame_end == client.ctx.callback_frame_end
+    assert not lib_client.AsyncModbusSerialClient(
+        "/dev/null", framer=FramerType.ASCII, bus_timing=True, frame_gap=0.01
+    ).ctx.bus_timing
+    assert not lib_client.AsyncModbusTcpClient("127.0.0.1").ctx.bus_timing
+
+
+class BusTransport:
+    """RS-485 line, slaves in alive respond after 10ms."""
+
+    def __init__(self, base, alive):
+        """Initialize BusTransport."""
+        self.base = base
+        self.alive = alive
+        self.polled = []
+        db = ModbusSequentialDataBlock(0, [0] * 100)
+        self.ctx = ModbusSlaveContext(di=db, co=db, hr=db, ir=db)
+
+    async def respond(self, request):
+        """Send response."""
+        await asyncio.sleep(0.01)
+        resp = await request.execute(self.ctx)
+        resp.slave_id = request.slave_id
+        self.base.ctx.data_received(self.base.ctx.framer.buildPacket(resp))
+
+    def write(self, data, addr=None):
+        """Write request."""
+        request = ServerDecoder().decode(data[1:-2])
+        request.slave_id = data[0]
+        self.polled.append(data[0])
+        if data[0] in self.alive:
+            asyncio.create_task(self.respond(request))
+
+    def close(self):
+        """Close the transport."""
+
+
+async def test_client_bus_master():
+    """Test requests are interleaved between slaves, offline slave is skipped."""
+    base = ModbusBaseClient(FramerType.RTU, timeout=0.05, retries=1, metrics=ModbusMetrics())
+    transport = BusTransport(base, {1, 2})
+    base.ctx.connection_made(transport=transport)
+    master = ModbusBusMaster(base, backoff=0.2)
+    master.set_timeout(3, 0.02)
+
+    requests = [pdu_bit_read.ReadCoilsRequest(0, 1, slave=slave) for slave in (1, 1, 1, 2, 2, 3, 3)]
+    results = await asyncio.gather(
+        *[master.execute(request) for request in requests], return_exceptions=True
+    )
+    assert transport.polled == [1, 2, 3, 1, 2, 3, 1]
+    assert [isinstance(res, ModbusIOException) for res in results] == [False] * 5 + [True] * 2
+    assert master.offline[3][1] == 0.2
+    stats = base.stats.requests
+    assert (stats[(1, 1)].requests, stats[(1, 1)].latency.count) == (3, 3)
+    assert (stats[(3, 1)].requests, stats[(3, 1)].errors) == (2, 2)
+    assert (stats[(3, 1)].timeouts, stats[(3, 1)].retries) == (2, 1)
+    assert (base.stats.queue_depth, base.stats.queue_depth_max) == (0, 7)
+    assert base.stats.bytes_out == 7 * 8
+
+    transport.polled.clear()
+    with pytest.raises(ModbusIOException):
+        await master.execute(pdu_bit_read.ReadCoilsRequest(0, 1, slave=3))
+    assert not transport.polled
+    await asyncio.sleep(0.2)
+    with pytest.raises(ModbusIOException):
+        await master.execute(pdu_bit_read.ReadCoilsRequest(0, 1, slave=3))
+    assert transport.polled == [3]
+    assert master.offline[3][1] == 0.4
+
+    master.offline[3] = (0, 0.4)
+    transport.alive.add(3)
+    assert not (await master.execute(pdu_bit_read.ReadCoilsRequest(0, 1, slave=3))).isError()
+    assert not master.offline
+    assert not master.queues
+    assert not list(base.ctx.transaction)
+
+
+async def test_client_bus_master_exception():
+    """Test an exception while polling fails the request, not the bus master."""
+    base = ModbusBaseClient(FramerType.RTU, timeout=0.05, retries=0, metrics=ModbusMetrics())
+    transport = BusTransport(base, {1})
+    base.ctx.connection_made(transport=transport)
+    master = ModbusBusMaster(base)
+    write = transport.write
+    transport.write = mock.Mock(side_effect=OSError("line down"))
+    with pytest.raises(OSError):
+        await master.execute(pdu_bit_read.ReadCoilsRequest(0, 1, slave=1))
+    assert base.stats.requests[(1, 1)].errors == 1
+    assert not master._task  # pylint: disable=protected-access
+    assert not list(base.ctx.transaction)
+    transport.write = write
+    assert not (await master.execute(pdu_bit_read.ReadCoilsRequest(0, 1, slave=1))).isError()
+
+
+async def test_serial_client_bus_master():
+    """Test async serial client uses bus master."""
+    client = lib_client.AsyncModbusSerialClient("/dev/null", bus_master=True)
+    assert client.bus_master.client is client
+    client.bus_master.execute = mock.AsyncMock(return_value="ok")
+    assert await client.async_execute(None) == "ok"
+    assert not lib_client.AsyncModbusSerialClient("/dev/null").bus_master
+
+
 def test_client_udp_connect():
     """Test the Udp client connection method."""
     with mock.patch.object(socket, "socket") as mock_method:
@@ -657,3 +890,77 @@ async def test_client_mixin_execute():
         client.execute(ModbusRequest())
     with pytest.raises(NotImplementedError):
         await client.execute(ModbusRequest())
+
+
+def test_client_mixin_plan_reads():
+    """Test read planner."""
+    tags = [(1, 10, 2), (1, 0, 4), (2, 0, 1), (1, 14, 1), (1, 3, 2), (1, 200, 10)]
+    blocks = ModbusClientMixin.plan_reads(tags, 3)
+    assert [(b.request.slave_id, b.request.address, b.request.count) for b in blocks] == [
+        (1, 0, 5), (1, 10, 2), (1, 14, 1), (1, 200, 10), (2, 0, 1)
+    ]
+    assert isinstance(blocks[0].request, pdu_reg_read.ReadHoldingRegistersRequest)
+    blocks = ModbusClientMixin.plan_reads(tags, 4, max_gap=5)
+    assert [(b.request.slave_id, b.request.address, b.request.count) for b in blocks] == [
+        (1, 0, 15), (1, 200, 10), (2, 0, 1)
+    ]
+    assert blocks[0].tags == [1, 4, 0, 3]
+    blocks = ModbusClientMixin.plan_reads([(1, x * 100, 100) for x in range(5)], 3, 100)
+    assert [b.request.count for b in blocks] == [100] * 5
+    blocks = ModbusClientMixin.plan_reads([(1, x * 1000, 1000) for x in range(5)], 1)
+    assert [b.request.count for b in blocks] == [2000, 2000, 1000]
+    assert isinstance(blocks[0].request, pdu_bit_read.ReadCoilsRequest)
+    assert not ModbusClientMixin.plan_reads([], 2)
+    with pytest.raises(ModbusException):
+        ModbusClientMixin.plan_reads(tags, 5)
+    with pytest.raises(ModbusException):
+        ModbusClientMixin.plan_reads([(1, 0, 126)], 3)
+
+
+def test_client_mixin_scatter_reads():
+    """Test read planner scatter."""
+    tags = [(1, 10, 2), (1, 0, 4), (1, 3, 2), (2, 0, 2)]
+    blocks = ModbusClientMixin.plan_reads(tags, 3, max_gap=5)
+    responses = [
+        pdu_reg_read.ReadHoldingRegistersResponse(list(range(12))),
+        pdu_reg_read.ReadHoldingRegistersRequest(0, 2, 2).doException(2),
+    ]
+    values = ModbusClientMixin.scatter_reads(tags, blocks, responses)
+    assert values[:3] == [[10, 11], [0, 1, 2, 3], [3, 4]]
+    assert values[3].isError()
+    tags = [(1, 2, 3), (1, 9, 1)]
+    blocks = ModbusClientMixin.plan_reads(tags, 2, max_gap=10)
+    responses = [pdu_bit_read.ReadDiscreteInputsResponse([True] * 3 + [False] * 5)]
+    assert ModbusClientMixin.scatter_reads(tags, blocks, responses) == [
+        [True, True, True], [False]
+    ]
+
+
+async def test_client_read_tags():
+    """Test read_tags with a running connection."""
+    base = ModbusBaseClient(FramerType.SOCKET, host="127.0.0.1", max_inflight=5)
+    db = ModbusSequentialDataBlock(1, list(range(100)))
+    ctx = ModbusSlaveContext(di=db, co=db, hr=db, ir=db)
+    server_framer = ModbusSocketFramer(ServerDecoder())
+
+    class LoopTransport:
+        """Respond to each request."""
+
+        def write(self, data, addr=None):
+            """Write data."""
+            server_framer.processIncomingPacket(
+                data, lambda rq: asyncio.create_task(respond(rq)), slave=0
+            )
+
+        def close(self):
+            """Close the transport."""
+
+    async def respond(request):
+        """Execute request and send response."""
+        resp = await request.execute(ctx)
+        resp.transaction_id = request.transaction_id
+        base.ctx.data_received(base.ctx.framer.buildPacket(resp))
+
+    base.ctx.connection_made(transport=LoopTransport())
+    values = await base.read_tags([(1, 50, 2), (1, 10, 3), (1, 12, 1)], 4)
+    assert values == [[50, 51], [10, 11, 12], [12]]
@@ -1,5 +1,10 @@
 """Test client sync."""
+import fcntl
+import os
 import socket
+import termios
+import threading
+import tty
 from itertools import count
 from unittest import mock
 
@@ -14,6 +19,7 @@ from pymodbus.client import (
     ModbusUdpClient,
 )
 from pymodbus.exceptions import ConnectionException
+from pymodbus.pdu.register_read_message import ReadInputRegistersResponse
 from pymodbus.transaction import (
     ModbusAsciiFramer,
     ModbusRtuFramer,
@@ -208,6 +214,15 @@ class TestSynchronousClient:  # pylint: disable=too-many-public-methods
         client.register(CustomRequest)
         client.framer.decoder.register.assert_called_once_with(CustomRequest)
 
+    def test_tcp_client_read_tags(self):
+        """Test tcp client read_tags."""
+        client = ModbusTcpClient("127.0.0.1")
+        client.execute = lambda request: ReadInputRegistersResponse(
+            list(range(request.address, request.address + request.count))
+        )
+        values = client.read_tags([(1, 50, 2), (1, 10, 3), (1, 12, 1)], 4)
+        assert values == [[50, 51], [10, 11, 12], [12]]
+
     # -----------------------------------------------------------------------#
     # Test TLS Client
     # -----------------------------------------------------------------------#
@@ -422,6 +437,47 @@ class TestSynchronousClient:  # pylint: disable=too-many-public-methods
         client.socket.timeout = 0
         assert client.recv(0) == b""
 
+    @pytest.mark.skipif(os.name == "nt", reason="Windows not supported")
+    def test_serial_client_recv_select(self):
+        """Test the serial client receive, waiting in select()."""
+
+        class PtySerial:
+            """Serial port on a pty."""
+
+            def __init__(self, fd):
+                """Initialize."""
+                self.fd = fd
+
+            def fileno(self):
+                """Return fd."""
+                return self.fd
+
+            @property
+            def in_waiting(self):
+                """Return waiting bytes."""
+                return int.from_bytes(
+                    fcntl.ioctl(self.fd, termios.FIONREAD, b"\0\0\0\0"), "little"
+                )
+
+            def read(self, size):
+                """Read."""
+                return os.read(self.fd, size)
+
+        master, slave = os.openpty()
+        tty.setraw(slave)
+        client = ModbusSerialClient("/dev/null", timeout=1)
+        client.socket = PtySerial(slave)
+        timer = threading.Timer(0.05, os.write, (master, b"\x01\x03\x02"))
+        timer.start()
+        assert client.recv(3) == b"\x01\x03\x02"
+        os.write(master, b"\x01\x03\x02\x00\x01")
+        assert client.recv(2) == b"\x01\x03"
+        assert client.recv(None) == b"\x02\x00\x01"
+        client.comm_params.timeout_connect = 0.05
+        assert client.recv(None) == b""
+        os.close(master)
+        os.close(slave)
+
     def test_serial_client_repr(self):
         """Test serial client."""
         client = ModbusSerialClient("/dev/null")
@@ -17,6 +17,7 @@ from examples.client_calls import main as main_client_calls
 from examples.client_calls import template_call
 from examples.client_custom_msg import main as main_custom_client
 from examples.client_payload import main as main_payload_calls
+from examples.client_performance import main as main_client_performance
 from examples.datastore_simulator_share import main as main_datastore_simulator_share
 from examples.message_generator import generate_messages
 from examples.message_parser import main as main_parse_messages
@@ -54,6 +55,28 @@ class TestExamples:
         main_parse_messages(["--framer", framer, "-m", "000100000006010100200001"])
         main_parse_messages(["--framer", framer, "-m", "00010000000401010101"])
 
+    async def test_client_performance(self, tmp_path):
+        """Test benchmark suite."""
+        json_file = tmp_path / "bench.json"
+        results = await main_client_performance(
+            [
+                "--count", "10",
+                "--comm", "tcp", "nullmodem",
+                "--framer", "socket",
+                "--client", "async",
+                "--json", str(json_file),
+            ]
+        )
+        assert [(res["comm"], "error" in res) for res in results] == [
+            ("tcp", False),
+            ("nullmodem", False),
+        ]
+        assert json_file.exists()
+        results = await main_client_performance(["--count", "1", "--decode"])
+        assert ("server", "diag_echo", "ReturnQueryDataRequest") in [
+            (res["decoder"], res["pdu"], res["class"]) for res in results
+        ]
+
     async def test_server_callback(self, use_port, use_host):
         """Test server/client with payload."""
         cmdargs = ["--port", str(use_port), "--host", use_host]
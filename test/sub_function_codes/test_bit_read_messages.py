@@ -15,6 +15,7 @@ from pymodbus.pdu.bit_read_message import (
     ReadCoilsRequest,
     ReadDiscreteInputsRequest,
 )
+from pymodbus.utilities import PackedBits
 from test.conftest import MockContext
 
 
@@ -76,6 +77,21 @@ class TestModbusBitMessage:
         for i in range(8):
             assert not handle.getBit(i)
 
+    def test_bit_read_base_response_packed(self):
+        """Test bit response decoded into PackedBits."""
+        handle = ReadBitsResponseBase(None)
+        handle.bits_as_packed = True
+        handle.decode(b"\x02\x0d\x01")
+        assert isinstance(handle.bits, PackedBits)
+        assert len(handle.bits) == 16
+        assert handle.getBit(0)
+        assert not handle.getBit(1)
+        assert handle.getBit(8)
+        handle.setBit(1)
+        handle.resetBit(8)
+        assert handle.bits[:4] == [True, True, True, True]
+        assert handle.encode() == b"\x02\x0f\x00"
+
     def test_bit_read_base_requests(self):
         """Test bit read request encoding."""
         messages = {
@@ -1,4 +1,9 @@
 """Test register read messages."""
+import struct
+from array import array
+
+import pytest
+
 from pymodbus.pdu import ModbusExceptions
 from pymodbus.pdu.register_read_message import (
     ReadHoldingRegistersRequest,
@@ -99,6 +104,15 @@ class TestReadRegisterMessages:
             request.decode(response)
             assert request.registers == register
 
+    def test_register_read_response_as_array(self):
+        """Test register read response decoded into an array."""
+        response = ReadHoldingRegistersResponse()
+        response.registers_as_array = True
+        response.decode(TEST_MESSAGE)
+        assert isinstance(response.registers, array)
+        assert response.registers.tolist() == [0x0A, 0x0B, 0x0C]
+        assert response.encode() == TEST_MESSAGE
+
     async def test_register_read_requests_count_errors(self):
         """This tests that the register request messages.
 
@@ -191,6 +205,33 @@ class TestReadRegisterMessages:
         assert request.write_byte_count == 0x0A
         assert request.write_registers == [0x00] * 5
 
+    @pytest.mark.parametrize(
+        "data",
+        [
+            b"\x00\x01\x00\x01\x00\x01\x00\x02\x04\x12\x34",
+            b"\x00\x01\x00\x01\x00\x01\x00\x02\x06\x12\x34\x56\x78",
+        ],
+    )
+    def test_read_write_multiple_registers_request_decode_truncated(self, data):
+        """Test read/write multiple registers rejects truncated data."""
+        with pytest.raises(struct.error):
+            ReadWriteMultipleRegistersRequest().decode(data)
+
+    @pytest.mark.parametrize(
+        "data",
+        [
+            b"\x00\x00\x00\x02\x06\x00\x01\x00\x02\x00\x03",
+            b"\x00\x01\x00\x01\x00\x01\x00\x02\x06\x00\x01\x00\x02\x00\x03",
+        ],
+    )
+    async def test_read_write_multiple_registers_byte_count_mismatch(self, data):
+        """Test inconsistent counts are answered with IllegalValue."""
+        request = ReadWriteMultipleRegistersRequest()
+        request.decode(data)
+        result = await request.execute(MockContext(True))
+        assert result.function_code == 0x97
+        assert result.exception_code == ModbusExceptions.IllegalValue
+
     def test_serializing_to_string(self):
         """Test serializing to string."""
         for request in iter(self.request_read.keys()):
@@ -1,4 +1,8 @@
 """Test register write messages."""
+import struct
+
+import pytest
+
 from pymodbus.payload import BinaryPayloadBuilder, Endian
 from pymodbus.pdu import ModbusExceptions
 from pymodbus.pdu.register_write_message import (
@@ -73,6 +77,26 @@ class TestWriteRegisterMessages:
             request.decode(response)
             assert request.address == address
 
+    @pytest.mark.parametrize(
+        "data",
+        [
+            b"\x00\x00\x00\x02\x04\x12\x34",
+            b"\x00\x00\x00\x02\x06\x00\x01\x00\x02",
+        ],
+    )
+    def test_write_multiple_registers_request_decode_truncated(self, data):
+        """Test write multiple registers rejects truncated data."""
+        with pytest.raises(struct.error):
+            WriteMultipleRegistersRequest().decode(data)
+
+    async def test_write_multiple_registers_request_byte_count_mismatch(self):
+        """Test byte count != 2 * count is answered with IllegalValue."""
+        request = WriteMultipleRegistersRequest()
+        request.decode(b"\x00\x00\x00\x02\x06\x00\x01\x00\x02\x00\x03")
+        result = await request.execute(MockContext(True))
+        assert result.function_code == 0x90
+        assert result.exception_code == ModbusExceptions.IllegalValue
+
     def test_invalid_write_multiple_registers_request(self):
         """Test invalid write multiple registers request."""
         request = WriteMultipleRegistersRequest(0, None)
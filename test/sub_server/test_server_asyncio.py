@@ -12,11 +12,18 @@ from pymodbus import FramerType
 from pymodbus.datastore import (
     ModbusSequentialDataBlock,
     ModbusServerContext,
+    ModbusSharedServerContext,
     ModbusSlaveContext,
 )
 from pymodbus.device import ModbusDeviceIdentification
 from pymodbus.exceptions import NoSuchSlaveException
-from pymodbus.server import ModbusTcpServer, ModbusTlsServer, ModbusUdpServer
+from pymodbus.pdu.register_read_message import ReadHoldingRegistersRequest
+from pymodbus.server import (
+    ModbusTcpServer,
+    ModbusTlsServer,
+    ModbusUdpServer,
+    StartMultiProcessTcpServer,
+)
 
 
 _logger = logging.getLogger()
@@ -230,6 +237,40 @@ class TestAsyncioServer:
         await self.connect_server()
         await asyncio.wait_for(BasicClient.done, timeout=0.1)
         assert BasicClient.received_data, expected_response
+        handler = next(iter(self.server.active_connections.values()))
+        assert not handler.request_tasks
+
+    async def test_async_tcp_server_request_pool(self):
+        """Test requests are reused, when request_pool_size is set."""
+        expected_response = b"\x01\x00\x00\x00\x00\x05\x01\x03\x02\x00\x11"
+        BasicClient.data = TEST_DATA
+        await self.start_server()
+        self.server.request_pool_size = 4
+        await self.connect_server()
+        await asyncio.wait_for(BasicClient.done, timeout=0.1)
+        handler = next(iter(self.server.active_connections.values()))
+        (request,) = handler.request_pool.free[ReadHoldingRegistersRequest]
+
+        BasicClient.done = asyncio.Future()
+        BasicClient.received_data = None
+        BasicClient.transport.write(TEST_DATA)
+        await asyncio.wait_for(BasicClient.done, timeout=0.1)
+        assert BasicClient.received_data == expected_response
+        assert handler.request_pool.free[ReadHoldingRegistersRequest] == [request]
+
+    async def test_async_tcp_server_request_exception(self):
+        """Test exceptions in request tasks are logged."""
+        BasicClient.data = TEST_DATA
+        await self.start_server()
+        with mock.patch(
+            "pymodbus.server.async_io.ModbusServerRequestHandler._async_execute",
+            side_effect=RuntimeError("failed"),
+        ), mock.patch("pymodbus.server.async_io.Log.error") as log_error:
+            await self.connect_server()
+            await asyncio.sleep(0.1)
+        handler = next(iter(self.server.active_connections.values()))
+        assert not handler.request_tasks
+        log_error.assert_called_once()
 
     async def test_async_tcp_server_connection_lost(self):
         """Test tcp stream interruption."""
@@ -367,3 +408,41 @@ class TestAsyncioServer:
             await self.connect_server()
             await asyncio.wait_for(BasicClient.eof, timeout=0.1)
             # neither of these should timeout if the test is successful
+
+
+async def test_async_tcp_server_reuse_port():
+    """Test two servers can listen on the same port with reuse_port."""
+    server1 = ModbusTcpServer(ModbusServerContext(), address=SERV_ADDR, reuse_port=True)
+    assert await server1.listen()
+    port = server1.transport.sockets[0].getsockname()[1]
+    server2 = ModbusTcpServer(
+        ModbusServerContext(), address=(SERV_IP, port), reuse_port=True
+    )
+    assert await server2.listen()
+    server1.close()
+    server2.close()
+
+
+def test_start_multi_process_tcp_server():
+    """Test worker processes are started with reuse_port."""
+    context = ModbusServerContext()
+    with mock.patch("pymodbus.server.async_io.multiprocessing.Process") as process:
+        process.return_value.is_alive.return_value = False
+        StartMultiProcessTcpServer(workers=3, context=context, address=SERV_ADDR)
+    assert process.call_count == 3
+    kwargs = process.call_args[1]["kwargs"]
+    assert kwargs["reuse_port"]
+    assert kwargs["context"] is context
+    assert process.return_value.start.call_count == 3
+    assert process.return_value.join.call_count == 3
+
+
+def test_start_multi_process_tcp_server_no_cache():
+    """Test the response cache is disabled with a shared context."""
+    context = mock.Mock(spec=ModbusSharedServerContext)
+    with mock.patch("pymodbus.server.async_io.multiprocessing.Process") as process:
+        process.return_value.is_alive.return_value = False
+        StartMultiProcessTcpServer(
+            workers=1, context=context, address=SERV_ADDR, response_cache_ttl=1
+        )
+    assert not process.call_args[1]["kwargs"]["response_cache_ttl"]
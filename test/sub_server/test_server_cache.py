@@ -0,0 +1,173 @@
+"""Test server response cache."""
+from unittest import mock
+
+from pymodbus.datastore import (
+    ModbusSequentialDataBlock,
+    ModbusServerContext,
+    ModbusSlaveContext,
+)
+from pymodbus.datastore.context import ModbusBaseSlaveContext
+from pymodbus.pdu.bit_read_message import ReadCoilsRequest
+from pymodbus.pdu.register_read_message import ReadHoldingRegistersRequest
+from pymodbus.pdu.register_write_message import WriteSingleRegisterRequest
+from pymodbus.server import ModbusTcpServer
+from pymodbus.server.async_io import ModbusServerRequestHandler
+from pymodbus.server.cache import ModbusResponseCache
+
+
+class TestServerCache:
+    """Test ModbusResponseCache."""
+
+    def setup_method(self):
+        """Set up the test environment."""
+        self.cache = ModbusResponseCache(10)
+        self.context = ModbusSlaveContext(
+            hr=ModbusSequentialDataBlock(0, list(range(100))), zero_mode=True
+        )
+
+    async def test_cache_hit(self):
+        """Test identical reads are served from cache."""
+        first = await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        second = await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        other = await self.cache.execute(ReadHoldingRegistersRequest(10, 6), self.context)
+        assert (self.cache.hits, self.cache.misses) == (1, 2)
+        assert first.registers == second.registers == [10, 11, 12, 13, 14]
+        assert other.registers == [10, 11, 12, 13, 14, 15]
+
+    async def test_cache_copies(self):
+        """Test each request gets its own response object."""
+        first = await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        first.transaction_id = 7
+        second = await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        second.transaction_id = 8
+        third = await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        assert self.cache.hits == 2
+        assert len({id(first), id(second), id(third)}) == 3
+        assert (first.transaction_id, second.transaction_id) == (7, 8)
+        assert not third.transaction_id
+
+    async def test_cache_write_invalidate(self):
+        """Test writes hitting the range invalidates."""
+        await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        self.context.setValues(3, 15, [1])
+        self.context.setValues(1, 10, [True])
+        await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        assert self.cache.hits == 1
+        await self.cache.execute(WriteSingleRegisterRequest(14, 99), self.context)
+        second = await self.cache.execute(ReadHoldingRegistersRequest(10, 5), self.context)
+        assert (self.cache.hits, self.cache.misses) == (1, 2)
+        assert second.registers[-1] == 99
+        assert len(self.context.write_listeners) == 1
+
+    async def test_cache_index(self):
+        """Test responses are indexed per context and store."""
+        context = ModbusSlaveContext(
+            hr=ModbusSequentialDataBlock(0, list(range(100))), zero_mode=True
+        )
+        for address in range(0, 50, 5):
+            await self.cache.execute(ReadHoldingRegistersRequest(address, 5), self.context)
+            await self.cache.execute(ReadHoldingRegistersRequest(address, 5), context)
+        await self.cache.execute(ReadCoilsRequest(0, 8), self.context)
+        assert len(self.cache.index) == 3
+        assert len(self.cache.index[(self.context, "h")]) == 10
+        self.context.setValues(6, 12, [1, 2, 3, 4])
+        assert len(self.cache.index[(self.context, "h")]) == 8
+        assert len(self.cache.index[(context, "h")]) == 10
+        assert len(self.cache.entries) == 19
+        self.cache.invalidate(self.context)
+        assert list(self.cache.index) == [(context, "h")]
+        assert len(self.cache.entries) == 10
+        self.cache.sweep(self.cache.next_sweep + 10)
+        assert not self.cache.entries
+        assert not self.cache.index
+
+    async def test_cache_ttl(self):
+        """Test cached responses expire."""
+        with mock.patch("pymodbus.server.cache.time.monotonic", return_value=100.0):
+            await self.cache.execute(ReadCoilsRequest(0, 8), self.context)
+            await self.cache.execute(ReadCoilsRequest(0, 8), self.context)
+            assert self.cache.hits == 1
+        with mock.patch("pymodbus.server.cache.time.monotonic", return_value=110.0):
+            await self.cache.execute(ReadCoilsRequest(0, 8), self.context)
+            assert (self.cache.hits, self.cache.misses) == (1, 2)
+
+    async def test_cache_sweep(self):
+        """Test expired responses are removed when adding responses."""
+        with mock.patch("pymodbus.server.cache.time.monotonic", return_value=100.0):
+            for address in range(20):
+                await self.cache.execute(ReadHoldingRegistersRequest(address, 1), self.context)
+        with mock.patch("pymodbus.server.cache.time.monotonic", return_value=105.0):
+            await self.cache.execute(ReadHoldingRegistersRequest(50, 1), self.context)
+        assert len(self.cache.entries) == 21
+        with mock.patch("pymodbus.server.cache.time.monotonic", return_value=111.0):
+            await self.cache.execute(ReadHoldingRegistersRequest(60, 1), self.context)
+        assert len(self.cache.entries) == 2
+        with mock.patch("pymodbus.server.cache.time.monotonic", return_value=116.0):
+            await self.cache.execute(ReadHoldingRegistersRequest(70, 1), self.context)
+        assert len(self.cache.entries) == 3  # next sweep at 121
+        with mock.patch("pymodbus.server.cache.time.monotonic", return_value=122.0):
+            await self.cache.execute(ReadHoldingRegistersRequest(80, 1), self.context)
+        assert len(self.cache.entries) == 2
+
+    async def test_cache_put_again(self):
+        """Test a response put again moves to the end (expiry order)."""
+        first = ReadHoldingRegistersRequest(10, 1)
+        second = ReadHoldingRegistersRequest(20, 1)
+        response = await first.execute(self.context)
+        for now, request in ((100.0, first), (101.0, second), (102.0, first)):
+            with mock.patch("pymodbus.server.cache.time.monotonic", return_value=now):
+                self.cache.put(self.context, request, response)
+        assert [key[2] for key in self.cache.entries] == [20, 10]
+        self.cache.sweep(111.5)
+        assert [key[2] for key in self.cache.entries] == [10]
+        assert len(self.cache.index[(self.context, "h")]) == 1
+
+    async def test_cache_no_errors(self):
+        """Test error responses are not cached."""
+        response = await self.cache.execute(ReadHoldingRegistersRequest(99, 5), self.context)
+        assert response.isError()
+        assert not self.cache.entries
+
+    async def test_cache_other_context(self):
+        """Test contexts without write listeners are invalidated by any write."""
+        context = ModbusBaseSlaveContext()
+        context.validate = lambda *_args: True
+        context.getValues = mock.Mock(return_value=[0] * 5)
+        await self.cache.execute(ReadHoldingRegistersRequest(10, 5), context)
+        await self.cache.execute(ReadHoldingRegistersRequest(10, 5), context)
+        assert context.getValues.call_count == 1
+        await self.cache.execute(WriteSingleRegisterRequest(90, 1), context)
+        assert not self.cache.entries
+        await self.cache.execute(ReadHoldingRegistersRequest(10, 5), context)
+        assert len(self.cache.entries) == 1
+        self.cache.invalidate()
+        assert not self.cache.entries
+
+    async def test_cache_broadcast(self):
+        """Test broadcast writes invalidate contexts without write listeners."""
+        context = ModbusBaseSlaveContext()
+        context.validate = lambda *_args: True
+        context.getValues = mock.Mock(return_value=[0] * 5)
+        server = ModbusTcpServer(
+            ModbusServerContext(slaves={1: context}, single=False),
+            address=("127.0.0.1", 0),
+            response_cache_ttl=10,
+            broadcast_enable=True,
+        )
+        handler = ModbusServerRequestHandler(server)
+        handler.server_send = mock.Mock()
+        await handler._execute_request(  # pylint: disable=protected-access
+            ReadHoldingRegistersRequest(10, 5, slave=1), None
+        )
+        assert server.response_cache.entries
+        await handler._execute_request(  # pylint: disable=protected-access
+            WriteSingleRegisterRequest(10, 1, slave=0), None
+        )
+        assert not server.response_cache.entries
+
+    async def test_server_cache(self):
+        """Test server parameter."""
+        context = ModbusServerContext(slaves=self.context, single=True)
+        assert not ModbusTcpServer(context, address=("127.0.0.1", 0)).response_cache
+        server = ModbusTcpServer(context, address=("127.0.0.1", 0), response_cache_ttl=0.5)
+        assert server.response_cache.ttl == 0.5
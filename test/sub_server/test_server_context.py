@@ -1,10 +1,25 @@
 """Test server context."""
+import pickle
+import subprocess
+import sys
+from pathlib import Path
+
 import pytest
 
-from pymodbus.datastore import ModbusServerContext, ModbusSlaveContext
+from pymodbus.datastore import (
+    ModbusServerContext,
+    ModbusSharedServerContext,
+    ModbusSlaveContext,
+)
 from pymodbus.exceptions import NoSuchSlaveException
 
 
+def write_shared(context, value):
+    """Write holding register 1 of slave 1 (worker process)."""
+    context[1].setValues(3, 1, [value])
+    context.close()
+
+
 class TestServerSingleContext:
     """This is the test for the pymodbus.datastore.ModbusServerContext using a single slave context."""
 
@@ -99,3 +114,84 @@ class TestServerMultipleContext:
         for slave_id, slave in iter(slaves.items()):
             actual = self.context[slave_id]
             assert slave == actual
+
+
+class TestServerSharedContext:
+    """This is the test for pymodbus.datastore.ModbusSharedServerContext."""
+
+    def test_shared_context(self):
+        """Test a context attached via pickle shares the values."""
+        context = ModbusSharedServerContext(slaves=[1, 5], size=20)
+        assert context.slaves() == [1, 5]
+        attached = pickle.loads(pickle.dumps(context))
+        context[1].setValues(3, 2, [0x1234, 0x5678])
+        context[5].setValues(1, 0, [True, False, True])
+        assert list(attached[1].getValues(3, 2, 2)) == [0x1234, 0x5678]
+        assert list(attached[5].getValues(1, 0, 3)) == [1, 0, 1]
+        assert not list(attached[1].getValues(1, 0, 3)) == [1, 0, 1]
+        attached[1].setValues(6, 0, [7])
+        assert list(context[1].getValues(4, 0, 1)) == [0]
+        assert list(context[1].getValues(3, 0, 1)) == [7]
+        assert not context[1].validate(3, 19, 2)
+        with pytest.raises(NoSuchSlaveException):
+            attached[2]  # pylint: disable=pointless-statement
+        attached.close()
+        context.unlink()
+
+    def test_shared_context_get_copy(self):
+        """Test values read are a copy, which does not pin the segment."""
+        context = ModbusSharedServerContext(slaves=[1], size=10)
+        context[1].setValues(3, 0, [1, 2, 3])
+        context[1].setValues(1, 0, [True, True])
+        registers = context[1].getValues(3, 0, 3)
+        bits = context[1].getValues(1, 0, 2)
+        context[1].setValues(3, 0, [7, 7, 7])
+        context[1].setValues(1, 0, [False, False])
+        context.unlink()
+        assert list(registers) == [1, 2, 3]
+        assert list(bits) == [1, 1]
+
+    def test_shared_context_single(self):
+        """Test a single shared context."""
+        context = ModbusSharedServerContext(size=10, zero_mode=True)
+        context[3].setValues(16, 9, [4])
+        assert list(context[0].getValues(3, 9, 1)) == [4]
+        context[0].reset()
+        assert list(context[0].getValues(3, 9, 1)) == [0]
+        context.unlink()
+
+    def test_shared_context_attach_untracked(self):
+        """Test attaching processes leave the segment to the creator.
+
+        The resource tracker must neither warn about a leaked segment nor
+        unlink it, for spawn workers (sharing the tracker of the creator)
+        and independent processes (with their own tracker).
+        """
+        script = """
+import multiprocessing, subprocess, sys
+from pymodbus.datastore import ModbusSharedServerContext
+from test.sub_server.test_server_context import write_shared
+
+context = ModbusSharedServerContext(slaves=[1], size=10)
+process = multiprocessing.get_context("spawn").Process(
+    target=write_shared, args=(context, 77)
+)
+process.start()
+process.join()
+assert list(context[1].getValues(3, 1, 1)) == [77]
+subprocess.run([sys.executable, "-c", (
+    "from pymodbus.datastore import ModbusSharedServerContext;"
+    "from test.sub_server.test_server_context import write_shared;"
+    f"write_shared(ModbusSharedServerContext([1], 10, name={context.shm.name!r}, create=False), 78)"
+)], check=True)
+assert list(context[1].getValues(3, 1, 1)) == [78]
+context.unlink()
+"""
+        result = subprocess.run(
+            [sys.executable, "-c", script],
+            capture_output=True,
+            text=True,
+            check=False,
+            cwd=Path(__file__).parents[2],
+        )
+        assert (result.returncode, result.stderr) == (0, "")
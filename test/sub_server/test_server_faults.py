@@ -0,0 +1,159 @@
+"""Test server fault injection."""
+import asyncio
+import time
+from unittest import mock
+
+import pytest
+
+from pymodbus.client import AsyncModbusTcpClient
+from pymodbus.datastore import (
+    ModbusSequentialDataBlock,
+    ModbusServerContext,
+    ModbusSlaveContext,
+)
+from pymodbus.exceptions import ModbusIOException
+from pymodbus.server import ModbusTcpServer
+from pymodbus.server.faults import ModbusFaultInjector, ModbusFaultProfile
+from pymodbus.transport import NULLMODEM_HOST
+
+
+class TestServerFaults:
+    """Test ModbusFaultInjector."""
+
+    pdu = b"\x00\x01\x00\x00\x00\x05\x01\x03\x02\x12\x34"
+
+    @staticmethod
+    @pytest.fixture(name="use_port")
+    def get_port_in_class(base_ports):
+        """Return next port."""
+        base_ports[__class__.__name__] += 1
+        return base_ports[__class__.__name__]
+
+    def setup_method(self):
+        """Set up the test environment."""
+        self.handler = self.make_handler("10.0.0.1")
+
+    @staticmethod
+    def make_handler(peer, port=None):
+        """Return mocked request handler."""
+        return mock.Mock(peer=peer, peer_port=port, send_lock=asyncio.Lock())
+
+    def sent(self):
+        """Return fragments sent."""
+        return [call.args[0] for call in self.handler.server_send.call_args_list]
+
+    async def test_faults_inactive(self):
+        """Test responses pass unchanged without profile."""
+        injector = ModbusFaultInjector()
+        response = mock.Mock()
+        await injector.send(self.handler, response, None)
+        self.handler.server_send.assert_called_once_with(response, None, skip_encoding=False)
+        assert not ModbusFaultProfile(split=1).active
+
+    async def test_faults_drop_corrupt(self):
+        """Test drop and corruption."""
+        injector = ModbusFaultInjector(ModbusFaultProfile(drop_rate=1), seed=1)
+        await injector.send(self.handler, self.pdu, None, skip_encoding=True)
+        assert not self.sent()
+        assert injector.dropped == 1
+        injector.default = ModbusFaultProfile(corrupt_rate=1)
+        await injector.send(self.handler, self.pdu, None, skip_encoding=True)
+        data = self.sent()[0]
+        assert len(data) == len(self.pdu)
+        diff = int.from_bytes(data, "big") ^ int.from_bytes(self.pdu, "big")
+        assert diff and not diff & (diff - 1)
+        assert injector.corrupted == 1
+
+    async def test_faults_split(self):
+        """Test fragments."""
+        injector = ModbusFaultInjector(ModbusFaultProfile(split=3, split_gap=0.01))
+        response = mock.Mock(should_respond=True)
+        self.handler.framer.buildPacket.return_value = self.pdu
+        await injector.send(self.handler, response, None)
+        assert len(self.sent()) == 3
+        assert b"".join(self.sent()) == self.pdu
+        injector.default.split = 20
+        await injector.send(self.handler, self.pdu, None, skip_encoding=True)
+        assert len(self.sent()) == 3 + len(self.pdu)
+        response.should_respond = False
+        await injector.send(self.handler, response, None)
+        assert injector.split == 2
+
+    async def test_faults_per_peer(self):
+        """Test delays are per peer and do not block other peers."""
+        injector = ModbusFaultInjector()
+        injector.peers["10.0.0.1"] = ModbusFaultProfile(delay=0.2)
+        other = self.make_handler("10.0.0.2")
+        start = time.monotonic()
+        slow = asyncio.create_task(
+            injector.send(self.handler, self.pdu, None, skip_encoding=True)
+        )
+        await asyncio.sleep(0)
+        await injector.send(other, self.pdu, None, skip_encoding=True)
+        assert time.monotonic() - start < 0.1
+        other.server_send.assert_called_once()
+        assert not self.sent()
+        await slow
+        assert self.sent() == [self.pdu]
+        assert injector.delayed == 1
+        await injector.send(other, self.pdu, ("10.0.0.1", 502), skip_encoding=True)
+        assert injector.delayed == 2
+
+    async def test_faults_per_connection(self):
+        """Test host:port profiles override host profiles."""
+        injector = ModbusFaultInjector()
+        injector.peers["10.0.0.1"] = ModbusFaultProfile(drop_rate=1)
+        injector.peers["10.0.0.1:5001"] = ModbusFaultProfile(corrupt_rate=1)
+        assert injector.profile("10.0.0.1", 5001).corrupt_rate == 1
+        assert injector.profile("10.0.0.1", 5002).drop_rate == 1
+        assert injector.profile("10.0.0.1").drop_rate == 1
+        assert not injector.profile("10.0.0.2", 5001).active
+        self.handler.peer_port = 5001
+        await injector.send(self.handler, self.pdu, None, skip_encoding=True)
+        assert injector.corrupted == 1
+        await injector.send(self.handler, self.pdu, ("10.0.0.1", 5002), skip_encoding=True)
+        assert injector.dropped == 1
+
+    async def test_faults_split_serialized(self):
+        """Test split responses on one connection do not interleave."""
+        injector = ModbusFaultInjector(ModbusFaultProfile(split=3, split_gap=0.01))
+        self.handler.send_lock = asyncio.Lock()
+        first = self.pdu
+        second = bytes(reversed(self.pdu))
+        await asyncio.gather(
+            injector.send(self.handler, first, None, skip_encoding=True),
+            injector.send(self.handler, second, None, skip_encoding=True),
+        )
+        assert b"".join(self.sent()) == first + second
+        split = asyncio.create_task(
+            injector.send(self.handler, first, None, skip_encoding=True)
+        )
+        await asyncio.sleep(0.005)
+        injector.default = ModbusFaultProfile()
+        await injector.send(self.handler, second, None, skip_encoding=True)
+        await split
+        assert b"".join(self.sent()[6:]) == first + second
+
+    async def test_server_faults(self, use_port):
+        """Test fault injection in a server."""
+        context = ModbusServerContext(
+            slaves={1: ModbusSlaveContext(hr=ModbusSequentialDataBlock(0, [17] * 100))},
+            single=False,
+        )
+        server = ModbusTcpServer(context, address=(NULLMODEM_HOST, use_port))
+        server.comm_params.host = NULLMODEM_HOST
+        server.fault_injector = ModbusFaultInjector(
+            ModbusFaultProfile(split=4, split_gap=0.01)
+        )
+        assert await server.listen()
+        client = AsyncModbusTcpClient(NULLMODEM_HOST, port=use_port, retries=0, timeout=0.2)
+        assert await client.connect()
+        response = await client.read_holding_registers(0, 10, slave=1)
+        assert response.registers == [17] * 10
+        assert server.fault_injector.split == 1
+        server.fault_injector.default = ModbusFaultProfile(drop_rate=1)
+        with pytest.raises(ModbusIOException):
+            await client.read_holding_registers(0, 10, slave=1)
+        assert server.fault_injector.dropped == 1
+        client.close()
+        await server.shutdown()
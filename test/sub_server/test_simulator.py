@@ -3,13 +3,20 @@
 import asyncio
 import copy
 import json
+import time
 from unittest.mock import mock_open, patch
 
 import pytest
 
 from pymodbus.datastore import ModbusSimulatorContext
-from pymodbus.datastore.simulator import Cell, CellType, Label
+from pymodbus.datastore.simulator import Cell, CellArray, CellType, Label
+from pymodbus.pdu.register_read_message import ReadHoldingRegistersResponse
 from pymodbus.server import ModbusSimulatorServer
+from pymodbus.server.simulator.http_server import (
+    MAX_SNAPSHOTS,
+    CallTraceBuffer,
+    CallTracer,
+)
 from pymodbus.transport import NULLMODEM_HOST
 
 
@@ -301,6 +308,58 @@ class TestSimulator:
         with pytest.raises(RuntimeError):
             ModbusSimulatorContext(exc_setup, None)
 
+    def test_simulator_repeat_large(self):
+        """Test repeating a block over a 65k register device is fast."""
+        exc_setup = copy.deepcopy(self.default_config)
+        exc_setup[Label.setup][Label.shared_blocks] = False
+        exc_setup[Label.setup][Label.co_size] = 10
+        exc_setup[Label.setup][Label.di_size] = 10
+        exc_setup[Label.setup][Label.hr_size] = 65535
+        exc_setup[Label.setup][Label.ir_size] = 10
+        exc_setup[Label.repeat] = [{"addr": [0, 48], "to": [49, 65564]}]
+        start = time.perf_counter()
+        simulator = ModbusSimulatorContext(exc_setup, None)
+        assert time.perf_counter() - start < 2.0
+        for offset in (0, 49, 49 * 1337):
+            for i, test_cell in enumerate(self.test_registers):
+                reg = simulator.registers[i + offset]
+                assert (reg.type, reg.value, reg.action) == (
+                    test_cell.type,
+                    test_cell.value,
+                    test_cell.action,
+                ), f"at index {i} - {offset}"
+
+    def test_simulator_cell_array_repeat(self):
+        """Test bulk repeat matches copying cell by cell."""
+        bulk, single = CellArray(30), CellArray(30)
+        for cells in (bulk, single):
+            cells[2].type = CellType.UINT16
+            cells[2].value = 7
+            cells[3].action = 2
+            cells[3].action_kwargs = {"minval": 1}
+            cells[4].count_read = 5
+            cells[20].action = 1
+            cells[21].count_write = 3
+        bulk.repeat(2, 5, 10, 22)
+        for inx in range(10, 22):
+            single[inx] = single[2 + (inx - 10) % 3]
+        for inx in range(30):
+            assert (
+                bulk[inx].type,
+                bulk[inx].value,
+                bulk[inx].action,
+                bulk[inx].action_kwargs,
+                bulk[inx].count_read,
+                bulk[inx].count_write,
+            ) == (
+                single[inx].type,
+                single[inx].value,
+                single[inx].action,
+                single[inx].action_kwargs,
+                single[inx].count_read,
+                single[inx].count_write,
+            ), f"at index {inx}"
+        assert bulk.action_list == single.action_list
 
     def test_simulator_validate_illegal(self):
         """Test validation without exceptions."""
@@ -410,6 +469,125 @@ class TestSimulator:
         assert [True, False, False] == result
         exc_simulator.setValues(FX_WRITE_BIT, 80, [True] * 17)
 
+    def test_simulator_cell_array(self):
+        """Test registers are kept in arrays, actions in a sparse table."""
+        cells = self.simulator.registers
+        assert len(cells) == len(cells.values) == len(cells.types) == 250
+        assert cells.values.itemsize == 2
+        actions = [i for i, cell in enumerate(self.test_registers) if cell.action]
+        assert cells.action_list == [
+            offset + i for offset in (0, 49, 98) for i in actions
+        ]
+        assert list(cells.action_kwargs) == [31, 80, 129]
+        cells[13].action = 0
+        cells[13].action_kwargs = None
+        assert 13 not in cells.action_list
+        assert cells.actions_in(14, 21) == [14, 19, 20]
+        cells[150] = cells[31]
+        assert (cells[150].type, cells[150].action) == (CellType.UINT32, 2)
+        assert cells[150].action_kwargs == {"minval": 10, "maxval": 80}
+        assert cells.actions_in(140, 160) == [150]
+        cells[17].value = 0x12345
+        assert cells[17].value == 0x2345
+        with pytest.raises(IndexError):
+            cells[250]  # pylint: disable=pointless-statement
+
+    def test_simulator_counters(self):
+        """Test read/write counters."""
+        self.simulator.getValues(FX_READ_REG, 16, 3)
+        self.simulator.getValues(FX_READ_REG, 17, 1)
+        self.simulator.setValues(FX_WRITE_REG, 16, [1, 2])
+        self.simulator.setValues(FX_WRITE_BIT, 16 * 5 + 15, [True, True])
+        regs = self.simulator.registers
+        assert [regs[i].count_read for i in range(15, 20)] == [0, 1, 2, 1, 0]
+        assert [regs[i].count_write for i in range(15, 19)] == [0, 1, 1, 0]
+        assert [regs[i].count_write for i in range(4, 8)] == [0, 1, 1, 0]
+        regs[17].count_read = 10
+        assert [regs[i].count_read for i in range(16, 19)] == [1, 10, 1]
+
+    def test_simulator_tick(self):
+        """Test tick() gives the same result as running the actions at read."""
+        exc_setup = copy.deepcopy(self.default_config)
+        exc_setup[Label.setup][Label.action_interval] = 0.5
+        simulator = ModbusSimulatorContext(exc_setup, None)
+        assert simulator.action_interval == 0.5
+        regs, ref = simulator.registers, self.simulator.registers
+        before = regs.values.tolist()
+        simulator.getValues(FX_READ_REG, 15, 48)
+        assert regs.values.tolist() == before
+        for _ in range(3):
+            simulator.tick()
+            self.simulator.getValues(FX_READ_REG, 15, 48)
+            self.simulator.getValues(FX_READ_REG, 64, 48)
+        for inx in (19, 20, 27, 28, 39, 40, 76, 77):
+            assert regs[inx].value == ref[inx].value, f"at register {inx}"
+        assert regs[27].value != before[27] or regs[28].value != before[28]
+        simulator.tick()
+        with pytest.raises(RuntimeError):
+            simulator.getValues(FX_READ_REG, 14, 1)
+
+        regs[60].action = simulator.action_name_to_id[Label.uptime]
+        regs[61].action = simulator.action_name_to_id[Label.timestamp]
+        simulator.tick()
+        assert 1 <= regs[60].value <= int(time.time()) - simulator.start_time + 1
+        assert regs[61].value > 2000
+        size = len(regs.values)
+        regs[size - 3].action = simulator.action_name_to_id[Label.timestamp]
+        regs[size - 1].action = simulator.action_name_to_id[Label.uptime]
+        regs[size - 1].type = CellType.UINT32
+        simulator.tick()
+        assert len(regs.values) == size
+
+        exc_setup = copy.deepcopy(self.default_config)
+        exc_setup[Label.setup][Label.action_interval] = -1
+        with pytest.raises(RuntimeError):
+            ModbusSimulatorContext(exc_setup, None)
+
+    async def test_simulator_action_engine(self):
+        """Test start/stop of the action engine."""
+        with pytest.raises(RuntimeError):
+            self.simulator.start_actions()
+        exc_setup = copy.deepcopy(self.default_config)
+        exc_setup[Label.setup][Label.action_interval] = 0.01
+        simulator = ModbusSimulatorContext(exc_setup, None)
+        with patch.object(simulator, "tick") as tick:
+            task = simulator.start_actions()
+            assert simulator.start_actions() is task
+            await asyncio.sleep(0.05)
+            simulator.stop_actions()
+            calls = tick.call_count
+            await asyncio.sleep(0.03)
+            assert tick.call_count == calls
+        assert calls >= 2
+        assert task.cancelled() or task.done()
+        with patch.object(simulator, "tick", side_effect=IndexError("bad")) as tick:
+            simulator.start_actions()
+            await asyncio.sleep(0.05)
+            assert tick.call_count >= 2
+            simulator.stop_actions()
+
+    def test_simulator_call_trace_buffer(self):
+        """Test call trace ring buffer."""
+        buffer = CallTraceBuffer(10)
+        for i in range(25):
+            assert buffer.append(CallTracer(call=True, fc=3 + i % 2, address=i % 5)) == i
+        assert (len(buffer), buffer.first_seq, buffer.next_seq) == (10, 15, 25)
+        assert [entry.address for entry in buffer] == [0, 1, 2, 3, 4] * 2
+        assert sum(len(seqs) for seqs in buffer.by_fc.values()) == 10
+        assert sum(len(seqs) for seqs in buffer.by_address.values()) == 10
+        assert [seq for seq, _ in buffer.since(0)] == list(range(15, 25))
+        assert [seq for seq, _ in buffer.since(22)] == [22, 23, 24]
+        assert [seq for seq, _ in buffer.since(0, limit=2)] == [15, 16]
+        assert [seq for seq, _ in buffer.since(0, fc=4)] == [15, 17, 19, 21, 23]
+        assert [seq for seq, _ in buffer.since(16, address=2)] == [17, 22]
+        assert [seq for seq, _ in buffer.since(0, fc=3, address=2)] == [22]
+        assert not buffer.since(0, fc=99)
+        buffer.clear()
+        assert not len(buffer)
+        assert not buffer.since(0)
+        assert buffer.append(CallTracer(fc=3)) == 25
+        assert [seq for seq, _ in buffer.since(0, fc=3)] == [25]
+
     def test_simulator_get_text(self):
         """Test get_text_register()."""
         for test_reg, test_entry, test_cell in (
@@ -599,3 +777,148 @@ class TestSimulator:
         await task.run_forever(only_start=True)
         await asyncio.sleep(0.5)
         await task.stop()
+
+    @patch(
+        "builtins.open",
+        mock_open(
+            read_data=json.dumps(
+                {
+                    "server_list": default_server_config,
+                    "device_list": {"device": default_config},
+                }
+            )
+        ),
+    )
+    async def test_simulator_server_response_faults(self):
+        """Test simulated responses use the fault injector."""
+        task = ModbusSimulatorServer(http_port=None)
+        assert task.modbus_server.fault_injector is task.fault_injector
+        params = {
+            "response_type": "0",
+            "response_split": "on",
+            "split_delay": "1",
+            "response_cr": "on",
+            "response_cr_pct": "10",
+            "response_delay": "2",
+            "response_junk_datalen": "",
+            "response_error": "4",
+            "response_clear_after": "2",
+        }
+        task.action_simulate(params, -1, -1)
+        response = ReadHoldingRegistersResponse([1])
+        for _ in range(2):
+            assert task.server_response_manipulator(response) == (response, False)
+            profile = task.fault_injector.default
+            assert (profile.delay, profile.split, profile.split_gap) == (2, 2, 1)
+            assert profile.corrupt_rate == 0.1
+        task.server_response_manipulator(response)
+        assert not task.fault_injector.default.active
+        params["response_type"] = "1"
+        task.action_simulate(params, -1, -1)
+        assert task.server_response_manipulator(response)[0].exception_code == 4
+        assert not task.fault_injector.default.active
+
+    @patch(
+        "builtins.open",
+        mock_open(
+            read_data=json.dumps(
+                {
+                    "server_list": default_server_config,
+                    "device_list": {"device": default_config},
+                }
+            )
+        ),
+    )
+    async def test_simulator_server_calls_json(self):
+        """Test call traces as json."""
+        task = ModbusSimulatorServer(http_port=None)
+        for i in range(5):
+            task.call_list.append(CallTracer(call=True, fc=3, address=i, count=1, data=b"\x01"))
+        result = task.build_json_calls_since({"since": "3"})
+        assert (result["first"], result["next"]) == (0, 5)
+        assert result["calls"][0] == {
+            "seq": 3, "call": True, "fc": 3, "address": 3, "count": 1, "data": "01"
+        }
+        result = task.build_json_calls_since({"limit": "2"})
+        assert [call["seq"] for call in result["calls"]] == [0, 1]
+        assert result["next"] == 2
+        result = task.build_json_calls_since({"since": "1", "address": "4"})
+        assert [call["seq"] for call in result["calls"]] == [4]
+
+    @patch(
+        "builtins.open",
+        mock_open(
+            read_data=json.dumps(
+                {
+                    "server_list": default_server_config,
+                    "device_list": {"device": default_config},
+                }
+            )
+        ),
+    )
+    async def test_simulator_server_registers_export(self):
+        """Test register export and bulk write."""
+        task = ModbusSimulatorServer(http_port=None)
+        values = task.datastore_context.registers.values
+
+        def export(params):
+            etag, _, headers, chunks = task.build_registers_export(params)
+            return etag, headers, b"".join(chunks)
+
+        etag, _, data = export({"start": "16", "count": "3"})
+        result = json.loads(data)
+        assert result == {
+            "start": 16, "count": 3, "next": 19, "etag": etag, "values": [3124, 5678, 5678]
+        }
+        assert export({"start": "16", "count": "3"})[0] == etag
+        assert export({"start": "17", "count": "2"})[0] != etag
+        _, headers, data = export({"start": "16", "count": "2", "format": "binary"})
+        assert data == b"\x0c\x34\x16\x2e"
+        assert headers["X-Next-Start"] == "18"
+        full_etag, _, data = export({})
+        assert len(json.loads(data)["values"]) == len(values)
+        etag, _, data = export({"count": "1"})
+        assert len(task.register_snapshots[etag][1]) == 2
+
+        _, _, chunks = task.build_registers_export({"start": "16", "count": "2"})[1:]
+        values[16] = 99
+        assert json.loads(b"".join(chunks))["values"] == [3124, 5678]
+        values[16] = 3124
+
+        etag = full_etag
+        assert task.registers_bulk_write(
+            {"writes": [{"register": 16, "values": [1, 2]}, {"register": 140, "values": [9]}]}
+        ) == {"written": 3}
+        assert values[16:18].tolist() == [1, 2]
+        new_etag, _, data = export({"changed_since": etag})
+        assert new_etag != etag
+        assert json.loads(data)["changes"] == [[16, 1], [17, 2], [140, 9]]
+        _, _, data = export({"changed_since": etag, "format": "binary", "start": "100"})
+        assert data == b"\x00\x00\x00\x8c\x00\x09"
+        assert "values" in json.loads(export({"changed_since": "unknown", "count": "1"})[2])
+        page_etag = export({"start": "16", "count": "2"})[0]
+        assert "values" in json.loads(export({"changed_since": page_etag, "count": "20"})[2])
+        values[17] = 3
+        assert json.loads(export({"changed_since": page_etag, "start": "17", "count": "1"})[2])[
+            "changes"
+        ] == [[17, 3]]
+
+        task.register_snapshots.clear()
+        oldest = export({"start": "0", "count": "20"})[0]
+        for inx in range(1, MAX_SNAPSHOTS):
+            export({"start": str(inx), "count": "1"})
+        assert next(iter(task.register_snapshots)) == oldest
+        values[5] = 7
+        assert json.loads(export({"changed_since": oldest, "count": "20"})[2])[
+            "changes"
+        ] == [[5, 7]]
+        assert oldest not in task.register_snapshots
+
+        for params in ({"start": "-1"}, {"count": str(len(values) + 1)}, {"format": "xml"}):
+            with pytest.raises(ValueError):
+                export(params)
+        with pytest.raises(ValueError):
+            task.registers_bulk_write({"writes": [{"register": 0, "values": [1]}, {"register": len(values), "values": [1]}]})
+        with pytest.raises(OverflowError):
+            task.registers_bulk_write({"writes": [{"register": 0, "values": [70000]}]})
+        assert values[0] != 1
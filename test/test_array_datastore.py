@@ -0,0 +1,74 @@
+"""Test array datastore."""
+from array import array
+
+import pytest
+
+from pymodbus.datastore import ModbusArrayDataBlock, ModbusSlaveContext
+from pymodbus.exceptions import ParameterException
+from pymodbus.pdu.bit_read_message import ReadCoilsRequest
+from pymodbus.pdu.register_read_message import ReadHoldingRegistersRequest
+
+
+def test_check_arraydatastore():
+    """Test get/set values."""
+    datablock = ModbusArrayDataBlock(10, [1, 2, 3, 4])
+    assert datablock.validate(10, 4)
+    assert not datablock.validate(9, 1)
+    assert not datablock.validate(11, 4)
+    assert list(datablock.getValues(11, 2)) == [2, 3]
+    datablock.setValues(12, [0x1234, 0xFFFF])
+    datablock.setValues(10, 7)
+    assert list(datablock.getValues(10, 4)) == [7, 2, 0x1234, 0xFFFF]
+    datablock.setValues(10, array("H", [5, 6]))
+    assert list(datablock) == [(10, 5), (11, 6), (12, 0x1234), (13, 0xFFFF)]
+    with pytest.raises(ParameterException):
+        ModbusArrayDataBlock(0, [1], typecode="L")
+
+
+async def test_check_async_arraydatastore():
+    """Test async get/set values."""
+    datablock = ModbusArrayDataBlock(0, 0)
+    await datablock.async_setValues(0, [9])
+    assert list(await datablock.async_getValues(0, 1)) == [9]
+
+
+def test_arraydatastore_copy():
+    """Test getValues returns a copy, and reset/default."""
+    datablock = ModbusArrayDataBlock.create()
+    assert len(datablock.values) == 65536
+    datablock.setValues(100, [1, 2, 3])
+    values = datablock.getValues(100, 3)
+    assert isinstance(values, array)
+    datablock.setValues(100, [4, 5, 6])
+    assert list(values) == [1, 2, 3]
+    datablock.reset()
+    assert list(datablock.getValues(100, 3)) == [0, 0, 0]
+    datablock.default(10, 5)
+    assert list(datablock.getValues(0, 10)) == [5] * 10
+
+
+def test_arraydatastore_numpy():
+    """Test numpy backed store."""
+    numpy = pytest.importorskip("numpy")
+    datablock = ModbusArrayDataBlock.create(use_numpy=True)
+    datablock.setValues(5, numpy.arange(3, dtype=numpy.uint16))
+    values = datablock.getValues(5, 3)
+    assert list(values) == [0, 1, 2]
+    datablock.setValues(6, [7])
+    assert list(values) == [0, 1, 2]
+    assert list(datablock.getValues(5, 3)) == [0, 7, 2]
+
+
+async def test_arraydatastore_pdu():
+    """Test read requests served from array stores."""
+    context = ModbusSlaveContext(
+        co=ModbusArrayDataBlock.create("B"),
+        hr=ModbusArrayDataBlock.create(),
+        zero_mode=True,
+    )
+    context.setValues(3, 1, [0x1234, 0x5678])
+    context.setValues(1, 2, [True, False, True])
+    response = await ReadHoldingRegistersRequest(0, 3).execute(context)
+    assert response.encode() == b"\x06\x00\x00\x12\x34\x56\x78"
+    response = await ReadCoilsRequest(0, 5).execute(context)
+    assert response.encode() == b"\x01\x14"
@@ -288,6 +288,11 @@ class TestDataStore:
         self.control.clearEvents()
         assert self.control.Events == []
         assert self.control.Counter.Event == 1
+        events = [ModbusEvent() for _ in range(70)]
+        for event in events:
+            self.control.addEvent(event)
+        assert self.control.Events == events[:-65:-1]
+        self.control.clearEvents()
 
     def test_retrieving_control_events(self):
         """Test adding and removing a host."""
@@ -2,7 +2,7 @@
 import pytest
 
 from pymodbus.exceptions import MessageRegisterException, ModbusException
-from pymodbus.factory import ClientDecoder, ServerDecoder
+from pymodbus.factory import ClientDecoder, ModbusRequestPool, ServerDecoder
 from pymodbus.pdu import ModbusRequest, ModbusResponse
 
 
@@ -212,3 +212,73 @@ class TestFactory:
             assert (
                 await result.execute(None)
             ).function_code == func, "Failed to create correct response message"
+
+    def test_decode_sub_function(self):
+        """Test sub functions decode directly to the final class."""
+        for decoder, suffix in ((self.server, "Request"), (self.client, "Response")):
+            pdu = decoder.decode(b"\x08\x00\x00\x12\x34")
+            assert pdu.__class__.__name__ == f"ReturnQueryData{suffix}"
+            assert pdu.message == b"\x12\x34"
+            pdu = decoder.decode(b"\x08\x00\x0b\x00\x00")
+            assert pdu.__class__.__name__ == f"ReturnBusMessageCount{suffix}"
+            pdu = decoder.decode(b"\x08\x7f\x7f\x00\x00")
+            assert pdu.__class__.__name__ == f"DiagnosticStatus{suffix}"
+        pdu = self.server.decode(b"\x2b\x0e\x01\x00")
+        assert pdu.__class__.__name__ == "ReadDeviceInformationRequest"
+        assert pdu.read_code == 1
+
+    def test_decode_custom_sub_function(self):
+        """Test custom sub function found after decode."""
+
+        class CustomRequest(ModbusRequest):
+            """Custom request."""
+
+            function_code = 0x44
+
+            def decode(self, data):
+                """Decode."""
+                self.sub_function_code = data[0]
+
+        class CustomSubRequest(CustomRequest):
+            """Custom sub request."""
+
+            sub_function_code = 0x02
+
+        self.server.register(CustomRequest)
+        self.server.register(CustomSubRequest)
+        assert self.server.decode(b"\x44\x02").__class__ is CustomSubRequest
+
+    def test_request_pool(self):
+        """Test pool reuses released requests, reset for the next decode."""
+        pool = ModbusRequestPool(self.server, size=1)
+        request = pool.decode(b"\x03\x00\x01\x00\x0a")
+        request.transaction_id = request.slave_id = 7
+        assert pool.decode(b"\x03\x00\x01\x00\x0a") is not request
+        pool.release(request)
+        reused = pool.decode(b"\x03\x00\x02\x00\x05")
+        assert reused is request
+        assert (reused.address, reused.count) == (2, 5)
+        assert not reused.transaction_id
+        assert not reused.slave_id
+
+        # requests not decode_sets_all are not reused.
+        class AppendRequest(ModbusRequest):
+            """Request appending to a list created in __init__()."""
+
+            function_code = 0x45
+
+            def __init__(self, **kwargs):
+                """Initialize."""
+                super().__init__(**kwargs)
+                self.data = []
+
+            def decode(self, data):
+                """Decode."""
+                self.data.append(data)
+
+        self.server.register(AppendRequest)
+        request = pool.decode(b"\x45\x01")
+        pool.release(request)
+        assert AppendRequest not in pool.free
+        assert pool.decode(b"\x45\x03").data == [b"\x03"]
+        assert pool.decode(b"\x60\x00").__class__.__name__ == "IllegalFunctionRequest"
@@ -4,7 +4,10 @@ from unittest import mock
 
 import pytest
 
-from pymodbus.logging import Log
+from pymodbus.factory import ClientDecoder
+from pymodbus.framer import ModbusSocketFramer
+from pymodbus.logging import Log, pymodbus_hot_path_logging
+from pymodbus.utilities import ModbusTransactionState
 
 
 class TestLogging:
@@ -21,6 +24,21 @@ class TestLogging:
             Log.debug("test2")
             build_msg_mock.assert_called_once()
 
+    def test_log_hot_path(self):
+        """Verify hot path debug calls are skipped when disabled."""
+        assert Log.hot_path
+        with mock.patch("pymodbus.logging.Log.debug") as debug_mock:
+            Log.setLevel(logging.DEBUG)
+            pymodbus_hot_path_logging(False)
+            assert not Log.hot_path
+            framer = ModbusSocketFramer(ClientDecoder())
+            framer.resetFrame()
+            debug_mock.assert_not_called()
+            pymodbus_hot_path_logging()
+            framer.resetFrame()
+            debug_mock.assert_called_once()
+        Log.setLevel(logging.NOTSET)
+
     def test_log_simple(self):
         """Test simple string."""
         txt = "simple string"
@@ -33,6 +51,7 @@ class TestLogging:
             ("string {} {} {}", "string 101 102 103", (101, 102, 103)),
             ("string {}", "string 0x41 0x42 0x43 0x44", (b"ABCD", ":hex")),
             ("string {}", "string 125", (125, ":str")),
+            ("string {}", "string IDLE", (ModbusTransactionState.IDLE, ":state")),
         ],
     )
     def test_log_parms(self, txt, result, params):
@@ -0,0 +1,140 @@
+"""Test metrics."""
+import asyncio
+from unittest import mock
+
+import pytest
+
+from pymodbus.client import AsyncModbusTcpClient
+from pymodbus.datastore import (
+    ModbusSequentialDataBlock,
+    ModbusServerContext,
+    ModbusSlaveContext,
+)
+from pymodbus.exceptions import ModbusIOException
+from pymodbus.metrics import ModbusLatencyHistogram, ModbusMetrics
+from pymodbus.pdu import ExceptionResponse
+from pymodbus.server import ModbusTcpServer
+from pymodbus.transport import NULLMODEM_HOST
+
+
+class TestMetrics:
+    """Test ModbusMetrics."""
+
+    @staticmethod
+    @pytest.fixture(name="use_port")
+    def get_port_in_class(base_ports):
+        """Return next port."""
+        base_ports[__class__.__name__] += 1
+        return base_ports[__class__.__name__]
+
+    def test_histogram(self):
+        """Test buckets and percentiles."""
+        hist = ModbusLatencyHistogram()
+        assert not hist.percentile(50)
+        for usec in range(1, 1001):
+            hist.record(usec / 1_000_000)
+        assert hist.count == 1000
+        assert (hist.min, hist.max) == (1, 1000)
+        for percent in (10, 50, 90, 99):
+            value = hist.percentile(percent) * 1_000_000
+            assert percent * 10 <= value <= percent * 10 * 1.0625
+        assert hist.percentile(100) == 0.001
+        assert len(hist.counts) < 120
+        hist.record(3600)
+        assert len(hist.counts) < 500
+        assert hist.to_dict()["max"] == 3600
+
+    @pytest.mark.parametrize("usec", [0, 31, 32, 33, 1023, 1024, 123456789])
+    def test_histogram_bucket(self, usec):
+        """Test values are counted in the right bucket."""
+        hist = ModbusLatencyHistogram()
+        hist.record(usec / 1_000_000)
+        index = len(hist.counts) - 1
+        assert hist.counts[index] == 1
+        assert hist.bucket_limit(index - 1) < usec <= hist.bucket_limit(index) or not usec
+        assert hist.bucket_limit(index) - usec <= usec / 16
+
+    def test_registry(self):
+        """Test counters, snapshot and reset."""
+        metrics = ModbusMetrics()
+        conn = metrics.connection("plc1")
+        assert metrics.connection("plc1") is conn
+        conn.enqueue()
+        conn.enqueue()
+        conn.dequeue()
+        stats = conn.request(1, 3)
+        assert conn.request(1, 3) is stats
+        stats.done(0, ExceptionResponse(3, 2))
+        conn.request(2, 16).done(0, None)
+        conn.request(2, 16).done(0, b"\x02\x90\x04")  # raw (manipulated) response
+        conn.bytes_in = 10
+        snapshot = metrics.snapshot()["connections"]["plc1"]
+        assert snapshot["bytes_in"] == 10
+        assert (snapshot["queue_depth"], snapshot["queue_depth_max"]) == (1, 2)
+        assert [(req["slave"], req["function_code"], req["requests"], req["errors"])
+            for req in snapshot["requests"]] == [(1, 3, 2, 1), (2, 16, 2, 0)]
+        text = metrics.prometheus()
+        assert 'pymodbus_requests_total{connection="plc1",slave="1",function_code="3"} 2' in text
+        assert 'pymodbus_latency_seconds_count{connection="plc1",slave="2",function_code="16"} 2' in text
+        assert 'pymodbus_bytes_in_total{connection="plc1"} 10' in text
+        metrics.reset()
+        assert metrics.connection("plc1") is conn
+        assert not conn.requests
+        assert (conn.bytes_in, conn.queue_depth_max) == (0, 1)
+
+    async def test_client_server(self, use_port):
+        """Test metrics collected by client and server."""
+        context = ModbusServerContext(
+            slaves={1: ModbusSlaveContext(hr=ModbusSequentialDataBlock(0, [17] * 100))},
+            single=False,
+        )
+        server_metrics = ModbusMetrics()
+        server = ModbusTcpServer(
+            context,
+            address=(NULLMODEM_HOST, use_port),
+            ignore_missing_slaves=True,
+            metrics=server_metrics,
+        )
+        server.comm_params.host = NULLMODEM_HOST
+        assert await server.listen()
+        metrics = ModbusMetrics()
+        client = AsyncModbusTcpClient(
+            NULLMODEM_HOST, port=use_port, retries=1, timeout=0.1, metrics=metrics
+        )
+        assert await client.connect()
+        await asyncio.gather(*(client.read_holding_registers(0, 10, slave=1) for _ in range(3)))
+        assert (await client.read_holding_registers(200, 1, slave=1)).isError()
+        with pytest.raises(ModbusIOException):
+            await client.read_holding_registers(0, 1, slave=7)
+        client.close()
+        await server.shutdown()
+
+        conn = metrics.connections[f"{NULLMODEM_HOST}:{use_port}"]
+        stats = conn.requests[(1, 3)]
+        assert (stats.requests, stats.errors, stats.timeouts, stats.retries) == (4, 1, 0, 0)
+        assert stats.latency.count == 4
+        stats = conn.requests[(7, 3)]
+        assert (stats.requests, stats.errors, stats.timeouts, stats.retries) == (1, 1, 2, 1)
+        assert (conn.queue_depth, conn.queue_depth_max) == (0, 3)
+        assert conn.bytes_out == 12 * 6
+        assert conn.bytes_in == 3 * 29 + 9
+
+        conn = server_metrics.connections[NULLMODEM_HOST]
+        stats = conn.requests[(1, 3)]
+        assert (stats.requests, stats.errors, stats.latency.count) == (4, 1, 4)
+        assert (conn.bytes_in, conn.bytes_out) == (12 * 6, 3 * 29 + 9)
+
+    async def test_client_protocol_crc_errors(self):
+        """Test CRC errors counted by the client protocol."""
+        client = AsyncModbusTcpClient("localhost", framer="rtu", metrics=ModbusMetrics())
+        handle = mock.Mock()
+        client.ctx._handle_response = handle  # pylint: disable=protected-access
+        client.ctx.callback_data(b"\x01\x03\x02\x00\x01\x00\x00")
+        crc_errors = client.ctx.framer.message_handler.crc_errors
+        assert crc_errors
+        assert client.stats.crc_errors == crc_errors
+        client.ctx.framer.resetFrame()
+        client.ctx.callback_data(b"\x01\x03\x02\x00\x01\x79\x84")
+        assert client.stats.crc_errors == crc_errors
+        assert client.stats.bytes_in == 14
+        handle.assert_called_once()
@@ -1,15 +1,39 @@
 """Test remote datastore."""
-
+import asyncio
 from unittest import mock
 
 import pytest
 
-from pymodbus.datastore.remote import RemoteSlaveContext
-from pymodbus.exceptions import NotImplementedException
+from pymodbus.client.base import ModbusBaseClient
+from pymodbus.client.mixin import ModbusClientMixin
+from pymodbus.datastore import ModbusSequentialDataBlock, ModbusSlaveContext
+from pymodbus.datastore.remote import AsyncRemoteSlaveContext, RemoteSlaveContext
+from pymodbus.exceptions import ModbusException, NotImplementedException
 from pymodbus.pdu import ExceptionResponse
 from pymodbus.pdu.bit_read_message import ReadCoilsResponse
 from pymodbus.pdu.bit_write_message import WriteMultipleCoilsResponse
 from pymodbus.pdu.register_read_message import ReadInputRegistersResponse
+from pymodbus.pdu.register_write_message import WriteSingleRegisterRequest
+
+
+class UpstreamClient(ModbusClientMixin):
+    """Async client, executing requests against a local datastore."""
+
+    read_tags = ModbusBaseClient.read_tags
+
+    def __init__(self):
+        """Initialize."""
+        super().__init__()
+        self.store = ModbusSlaveContext(
+            hr=ModbusSequentialDataBlock(0, list(range(200))), zero_mode=True
+        )
+        self.requests = []
+
+    async def execute(self, request):
+        """Execute request."""
+        self.requests.append((request.function_code, request.address, getattr(request, "count", 1)))
+        await asyncio.sleep(0)
+        return await request.execute(self.store)
 
 
 class TestRemoteDataStore:
@@ -107,3 +131,90 @@ class TestRemoteDataStore:
 
         result = context.validate(3, 0, 10)
         assert result
+
+
+class TestAsyncRemoteDataStore:
+    """Unittest for AsyncRemoteSlaveContext."""
+
+    async def test_async_remote_coalesce(self):
+        """Test concurrent reads are coalesced and deduplicated."""
+        client = UpstreamClient()
+        context = AsyncRemoteSlaveContext(client, slave=1)
+        assert str(context)
+        results = await asyncio.gather(
+            context.async_getValues(3, 10, 5),
+            context.async_getValues(3, 10, 5),
+            context.async_getValues(3, 15, 5),
+            context.async_getValues(3, 100, 2),
+            context.async_getValues(3, 12, 2),
+        )
+        assert results == [
+            [10, 11, 12, 13, 14],
+            [10, 11, 12, 13, 14],
+            [15, 16, 17, 18, 19],
+            [100, 101],
+            [12, 13],
+        ]
+        assert client.requests == [(3, 10, 10), (3, 100, 2)]
+        assert not context._reads  # pylint: disable=protected-access
+        await asyncio.sleep(0)
+        assert not context._tasks  # pylint: disable=protected-access
+
+    async def test_async_remote_write(self):
+        """Test writes are forwarded."""
+        client = UpstreamClient()
+        context = AsyncRemoteSlaveContext(client)
+        assert context.validate(6, 10, 1)
+        assert not context.validate(3, 0xFFFF, 2)
+        response = await WriteSingleRegisterRequest(10, 77).execute(context)
+        assert response.value == 77
+        assert await context.async_setValues(5, 1, [True]) == [True]
+        assert await context.async_getValues(5, 1, 1) == [True]
+        assert await context.async_setValues(0x10, 20, [1, 2]) is None
+        assert await context.async_getValues(0x17, 10, 2) == [77, 11]
+        assert await context.async_getValues(3, 10, 1) == [77]
+        client.store.zero_mode = False
+        with pytest.raises(ModbusException):
+            await context.async_setValues(0x10, 199, [1, 2])
+        with pytest.raises(ValueError):
+            await context.async_setValues(3, 10, [1])
+
+    async def test_async_remote_concurrent_writes(self):
+        """Test concurrent single writes each return their own value."""
+        client = UpstreamClient()
+        context = AsyncRemoteSlaveContext(client)
+        responses = await asyncio.gather(
+            *(WriteSingleRegisterRequest(10, value).execute(context) for value in (1, 2, 3))
+        )
+        assert [response.value for response in responses] == [1, 2, 3]
+
+    async def test_async_remote_reset(self):
+        """Test reset fails collected reads and keeps the context usable."""
+        client = UpstreamClient()
+        context = AsyncRemoteSlaveContext(client, delay=0.05)
+        pending = asyncio.create_task(context.async_getValues(3, 10, 2))
+        await asyncio.sleep(0)
+        context.reset()
+        with pytest.raises(ModbusException):
+            await pending
+        assert not context._reads  # pylint: disable=protected-access
+        assert await context.async_getValues(3, 10, 2) == [10, 11]
+        assert client.requests == [(3, 10, 2)]
+
+    async def test_async_remote_errors(self):
+        """Test upstream errors."""
+        client = UpstreamClient()
+        context = AsyncRemoteSlaveContext(client)
+        results = await asyncio.gather(
+            context.async_getValues(3, 190, 5),
+            context.async_getValues(3, 195, 10),
+            return_exceptions=True,
+        )
+        assert results[0] == [190, 191, 192, 193, 194]
+        assert isinstance(results[1], ModbusException)
+        # merged read fails, single reads are retried.
+        assert client.requests == [(3, 190, 15), (3, 190, 5), (3, 195, 10)]
+
+        client.execute = mock.AsyncMock(side_effect=ModbusException("timeout"))
+        with pytest.raises(ModbusException):
+            await context.async_getValues(3, 0, 1)
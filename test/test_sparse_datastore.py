@@ -1,8 +1,11 @@
 """Test framers."""
 
+import time
+
 import pytest
 
 from pymodbus.datastore import ModbusSparseDataBlock
+from pymodbus.exceptions import ParameterException
 
 
 @pytest.mark.asyncio()
@@ -46,3 +49,94 @@ def test_check_sparsedatastore():
             assert datablock.validate(key, 1)
             assert datablock.getValues(key, 1) == [value]
             key += 1
+
+
+def test_sparsedatastore_runs():
+    """Test contiguous runs are merged and split correctly."""
+    datablock = ModbusSparseDataBlock({10: [1, 2, 3], 20: [4, 5]})
+    assert datablock.validate(10, 3)
+    assert not datablock.validate(10, 4)
+    assert not datablock.validate(12, 9)
+    with pytest.raises(KeyError):
+        datablock.getValues(13, 1)
+    datablock.setValues(13, [6] * 7)
+    assert datablock.validate(10, 12)
+    assert datablock.getValues(11, 11) == [2, 3] + [6] * 7 + [4, 5]
+    datablock.setValues(8, [7, 8, 9])
+    assert datablock.getValues(8, 4) == [7, 8, 9, 2]
+    datablock.reset()
+    assert datablock.values == {10: 1, 11: 2, 12: 3, 20: 4, 21: 5}
+    assert not datablock.validate(13, 1)
+
+
+def test_sparsedatastore_immutable():
+    """Test immutable datastore only accepts known addresses."""
+    datablock = ModbusSparseDataBlock({10: [1, 2, 3], 20: 4}, mutable=False)
+    datablock.setValues(11, [5, 6])
+    assert datablock.getValues(10, 3) == [1, 5, 6]
+    with pytest.raises(ParameterException):
+        datablock.setValues(12, [7, 8])
+    with pytest.raises(ParameterException):
+        datablock.setValues(0, {30: 1})
+
+
+def test_sparsedatastore_values_view():
+    """Test values is a write through {address: value} mapping."""
+    datablock = ModbusSparseDataBlock({10: [1, 2, 3]})
+    values = datablock.values
+    values[11] = 7
+    values[13] = 8
+    assert datablock.getValues(10, 4) == [1, 7, 3, 8]
+    values.update({30: 9})
+    assert datablock.getValues(30, 1) == [9]
+    del values[11]
+    assert not datablock.validate(10, 2)
+    assert datablock.getValues(12, 2) == [3, 8]
+    with pytest.raises(KeyError):
+        del values[11]
+    assert dict(values) == {10: 1, 12: 3, 13: 8, 30: 9}
+    assert values == {10: 1, 12: 3, 13: 8, 30: 9}
+    assert list(datablock) == [(10, 1), (12, 3), (13, 8), (30, 9)]
+    datablock.reset()
+    assert datablock.values == {10: 1, 11: 2, 12: 3}
+
+
+def test_sparsedatastore_merge_runs():
+    """Test prepend/append/bridge writes against a dict reference."""
+    datablock = ModbusSparseDataBlock({10: [1, 2], 14: [3], 20: [4, 5, 6]})
+    expected = dict(datablock.values)
+    for address, values in (
+        (8, [7, 8]),
+        (12, [9, 9]),
+        (5, [1] * 20),
+        (30, [2]),
+        (29, [3]),
+        (31, [4, 4]),
+        (25, [5] * 4),
+    ):
+        datablock.setValues(address, values)
+        expected.update(zip(range(address, address + len(values)), values))
+        assert datablock.values == expected
+    assert datablock.validate(5, 28)
+    assert not datablock.validate(5, 29)
+
+
+def test_sparsedatastore_scaling():
+    """Test building, resetting and growing the datastore is linear."""
+
+    def measure(count):
+        best = None
+        for _ in range(3):
+            start = time.perf_counter()
+            datablock = ModbusSparseDataBlock(dict.fromkeys(range(count), 1))
+            datablock.reset()
+            datablock.values = datablock.default_value
+            for address in range(count, 2 * count):
+                datablock.setValues(address, [2])
+            delta = time.perf_counter() - start
+            best = delta if best is None else min(best, delta)
+        assert datablock.validate(0, 2 * count)
+        return best
+
+    small = measure(5000)
+    assert measure(40000) < small * 8 * 4
@@ -1,11 +1,17 @@
 """Test utilities."""
 import struct
+from array import array
+
+import pytest
 
 from pymodbus.utilities import (
+    PackedBits,
     default,
     dict_property,
     pack_bitstring,
+    pack_registers,
     unpack_bitstring,
+    unpack_registers,
 )
 
 
@@ -90,3 +96,40 @@ class TestUtility:
         """Test all string <=> bit packing functions."""
         assert unpack_bitstring(b"\x55") == self.bits
         assert pack_bitstring(self.bits) == b"\x55"
+        assert pack_bitstring([]) == b""
+        assert pack_bitstring([1, 0, 2, 0, 0, 0, 0, 0, 1]) == b"\x05\x01"
+        assert unpack_bitstring(memoryview(b"\x01\x80")) == [True] + [False] * 14 + [
+            True
+        ]
+
+    def test_packed_bits(self):
+        """Test PackedBits behaves like a list of bits."""
+        bits = PackedBits(b"\x55\x01", 9)
+        assert len(bits) == 9
+        assert bits == self.bits + [True]
+        assert bits[0]
+        assert not bits[1]
+        assert bits[-1]
+        assert bits[0:3] == [True, False, True]
+        assert list(bits) == self.bits + [True]
+        bits[1] = True
+        bits[8] = False
+        assert pack_bitstring(bits) == b"\x57\x00"
+        assert PackedBits(b"\xff", 3).tobytes() == b"\x07"
+        assert bits != PackedBits(b"\x57\x00", 10)
+        with pytest.raises(IndexError):
+            bits[9]  # pylint: disable=pointless-statement
+
+    def test_register_packing(self):
+        """Test all register <=> bytes packing functions."""
+        values = [0x1234, 0x2345, 0x3456, 0x4567]
+        assert pack_registers(values) == self.data
+        assert pack_registers(array("H", values)) == self.data
+        assert pack_registers([]) == b""
+        assert unpack_registers(self.data) == values
+        assert unpack_registers(memoryview(self.data)) == values
+        with pytest.raises(struct.error):
+            unpack_registers(self.data + b"\x01")
+        result = unpack_registers(self.data, as_array=True)
+        assert isinstance(result, array)
+        assert list(result) == values
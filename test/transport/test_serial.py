@@ -11,6 +11,7 @@ import serial
 from pymodbus.transport.serialtransport import (
     SerialTransport,
     create_serial_connection,
+    serial_timing,
 )
 
 
@@ -104,6 +105,45 @@ class TestTransportSerial:
         transport.close()
         SerialTransport.force_poll = False
 
+    async def test_force_thread(self):
+        """Test reader thread."""
+        SerialTransport.force_thread = True
+        transport, protocol = await create_serial_connection(
+            asyncio.get_running_loop(), mock.Mock, url="dummy", baudrate=9600
+        )
+        transport.sync_serial = mock.MagicMock()
+        transport.sync_serial.read.side_effect = [b"abcd", serial.SerialException("test")]
+        await asyncio.sleep(0.1)
+        SerialTransport.force_thread = False
+        protocol.data_received.assert_called_once_with(b"abcd")
+        protocol.connection_lost.assert_called_once()
+        assert not transport.sync_serial
+
+    async def test_write_force_thread(self):
+        """Test write with reader thread."""
+        comm = SerialTransport(asyncio.get_running_loop(), mock.Mock(), "dummy")
+        comm.reader_thread = mock.Mock()
+        comm.sync_serial = mock.MagicMock()
+        comm.sync_serial.write.side_effect = [2, BlockingIOError("test"), 2]
+        comm.write(b"abcd")
+        await asyncio.sleep(0.1)
+        assert comm.sync_serial.write.call_args_list == [
+            mock.call(b"abcd"),
+            mock.call(b"cd"),
+            mock.call(b"cd"),
+        ]
+        assert not comm.intern_write_buffer
+        comm.close()
+        comm.sync_serial = None
+
+    def test_serial_timing(self):
+        """Test char time, t1.5 and t3.5."""
+        assert serial_timing(9600) == pytest.approx((10 / 9600, 15 / 9600, 35 / 9600))
+        assert serial_timing(9600, 8, "E", 1)[2] == pytest.approx(3.5 * 11 / 9600)
+        assert serial_timing(115200)[1:] == (0.00075, 0.00175)
+        comm = SerialTransport(mock.Mock(), mock.Mock(), "dummy", baudrate=9600, parity="O")
+        assert comm.frame_gap == pytest.approx(3.5 * 11 / 9600)
+
     async def test_close(self):
         """Test close."""
         comm = SerialTransport(asyncio.get_running_loop(), mock.Mock(), "dummy")